@@ -0,0 +1,774 @@
+/*
+ *  On-target micro benchmarks, results go to the debug log
+ *  call bench_run() from main() after tcpip_init()
+ */
+
+#include <string.h>
+#include "sys.h"
+#include "osal.h"
+#include "slab.h"
+#include "twheel.h"
+#include "lwip/opt.h"
+#include "lwip/memp.h"
+#include "lwip/pbuf.h"
+#include "lwip/stats.h"
+#include "lwip/sys.h"
+#include "lwip/sockets.h"
+#include "lwip/tcpip.h"
+#include "sys_hrtimer.h"
+#include "coro.h"
+#include "mrf.h"
+#include "mrf_filter.h"
+
+#define BENCH_APPEND_MAX    4096
+
+/* grow a buffer by 'step' bytes until BENCH_APPEND_MAX, like cacheUpdate() does on every hash update */
+static uint32_t bench_append(size_t step, bool fragment) {
+    void * hole[BENCH_APPEND_MAX / 64];
+    uint8_t * buf = NULL, * p;
+    size_t size, n = 0;
+    uint32_t start = ReadCoreTimer();
+    for (size = step; size <= BENCH_APPEND_MAX; size += step) {
+        p = (uint8_t *) pvPortRealloc(buf, size);
+        if (NULL == p)
+            break;
+        buf = p;
+        memset(buf + size - step, 0xA5, step);
+        if (fragment && n < sizeof (hole) / sizeof (hole[0]))
+            hole[n++] = pvPortMalloc(8); // pins the block, forces a move
+    }
+    uint32_t elapsed = ReadCoreTimer() - start;
+    while (n)
+        vPortFree(hole[--n]);
+    vPortFree(buf);
+    return elapsed / us_SCALE;
+}
+
+void bench_realloc(void) {
+    static const size_t steps[] = {16, 64, 256};
+    size_t i, heap = xPortGetFreeHeapSize();
+    for (i = 0; i < sizeof (steps) / sizeof (steps[0]); i++) {
+        LOG("[BENCH] realloc append %3u: %6u us, fragmented %6u us\n",
+                steps[i], bench_append(steps[i], false), bench_append(steps[i], true));
+    }
+    if (heap != xPortGetFreeHeapSize())
+        LOG("[BENCH] realloc leaked %u bytes\n", heap - xPortGetFreeHeapSize());
+}
+
+#define BENCH_MEMP_LOOPS    1000
+#define BENCH_TCP_PORT      5001
+#define BENCH_TCP_BYTES     (256 * 1024)
+#define BENCH_TCP_CHUNK     1024
+
+static uint32_t bench_memp_type(memp_t type) {
+    void * p[8];
+    int i, j;
+    uint32_t start = ReadCoreTimer();
+    for (i = 0; i < BENCH_MEMP_LOOPS; i++) {
+        for (j = 0; j < 8; j++)
+            p[j] = memp_malloc(type);
+        for (j = 0; j < 8; j++)
+            memp_free(type, p[j]);
+    }
+    return (ReadCoreTimer() - start) / (BENCH_MEMP_LOOPS * 8 * 2 / 1000); // core ticks per 1000 ops
+}
+
+static uint32_t bench_pbuf(pbuf_type type, u16_t size) {
+    struct pbuf * p;
+    int i;
+    uint32_t start = ReadCoreTimer();
+    for (i = 0; i < BENCH_MEMP_LOOPS; i++) {
+        p = pbuf_alloc(PBUF_RAW, size, type);
+        if (p)
+            pbuf_free(p);
+    }
+    return (ReadCoreTimer() - start) / (BENCH_MEMP_LOOPS * 2 / 1000);
+}
+
+static void bench_tcp_sink(void * arg) {
+    static char buf[BENCH_TCP_CHUNK];
+    struct sockaddr_in addr;
+    int s, c, n;
+    memset(&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = PP_HTONS(BENCH_TCP_PORT);
+    addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+    s = socket(AF_INET, SOCK_STREAM, 0);
+    if (s >= 0 && 0 == bind(s, (struct sockaddr *) &addr, sizeof (addr)) && 0 == listen(s, 1)) {
+        xTaskNotifyGive((TaskHandle_t) arg); // listening
+        if ((c = accept(s, NULL, NULL)) >= 0) {
+            while ((n = recv(c, buf, sizeof (buf), 0)) > 0);
+            close(c);
+        }
+    }
+    if (s >= 0)
+        close(s);
+    lwip_socket_thread_cleanup();
+    xTaskNotifyGive((TaskHandle_t) arg); // done
+    vTaskDelete(NULL);
+}
+
+/* TCP over the loopback netif: exercises segments, pbufs, tcpip messages and timeouts */
+static uint32_t bench_tcp(void) {
+    static char buf[BENCH_TCP_CHUNK];
+    struct sockaddr_in addr;
+    int s, n, sent = 0;
+    uint32_t start, elapsed;
+    if (pdPASS != xTaskCreate(bench_tcp_sink, "SINK", 512, xTaskGetCurrentTaskHandle(), TASK_PRIORITY_NORMAL, NULL))
+        return 0;
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    memset(&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = PP_HTONS(BENCH_TCP_PORT);
+    addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+    memset(buf, 0x5A, sizeof (buf));
+    start = TickMS();
+    s = socket(AF_INET, SOCK_STREAM, 0);
+    if (s >= 0 && 0 == connect(s, (struct sockaddr *) &addr, sizeof (addr))) {
+        while (sent < BENCH_TCP_BYTES && (n = send(s, buf, sizeof (buf), 0)) > 0)
+            sent += n;
+    }
+    if (s >= 0)
+        close(s);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    elapsed = TickMS() - start;
+    return elapsed ? (uint32_t) sent / elapsed : 0; // bytes per ms = kB/s
+}
+
+#define BENCH_RTT_PORT      5002
+#define BENCH_RTT_LOOPS     1000
+
+static void bench_rtt_echo(void * arg) {
+    struct sockaddr_in addr, from;
+    socklen_t len;
+    char c;
+    int s;
+    memset(&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = PP_HTONS(BENCH_RTT_PORT);
+    addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+    s = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s >= 0 && 0 == bind(s, (struct sockaddr *) &addr, sizeof (addr))) {
+        xTaskNotifyGive((TaskHandle_t) arg); // bound
+        len = sizeof (from);
+        while (recvfrom(s, &c, 1, 0, (struct sockaddr *) &from, &len) == 1 && c) {
+            sendto(s, &c, 1, 0, (struct sockaddr *) &from, len);
+            len = sizeof (from);
+        }
+    }
+    if (s >= 0)
+        close(s);
+    lwip_socket_thread_cleanup();
+    xTaskNotifyGive((TaskHandle_t) arg); // done
+    vTaskDelete(NULL);
+}
+
+/* UDP ping-pong over loopback, two lwip_send and two lwip_recv per round trip, each one blocks on a sys_sem or mailbox */
+static uint32_t bench_rtt(void) {
+    struct sockaddr_in addr;
+    uint32_t i, start, ticks = 0;
+    char c = 'x';
+    int s;
+    if (pdPASS != xTaskCreate(bench_rtt_echo, "ECHO", 512, xTaskGetCurrentTaskHandle(), TASK_PRIORITY_NORMAL, NULL))
+        return 0;
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    memset(&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = PP_HTONS(BENCH_RTT_PORT);
+    addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+    s = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s >= 0 && 0 == connect(s, (struct sockaddr *) &addr, sizeof (addr))) {
+        for (i = 0; i < BENCH_RTT_LOOPS; i++) {
+            start = ReadCoreTimer();
+            if (send(s, &c, 1, 0) != 1 || recv(s, &c, 1, 0) != 1)
+                break;
+            ticks += ReadCoreTimer() - start;
+        }
+        c = 0; // stops the echo task
+        send(s, &c, 1, 0);
+    } else {
+        i = 0;
+    }
+    if (s >= 0)
+        close(s);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    return i ? ticks / i : 0;
+}
+
+void bench_memp(void) {
+    int i;
+    LOG("[BENCH] memp %s, ticks per 1000 ops\n", MEMP_MEM_MALLOC ? "heap" : "pools");
+    LOG("[BENCH] memp TCP_SEG %u, PBUF %u, TCPIP_MSG %u\n",
+            bench_memp_type(MEMP_TCP_SEG), bench_memp_type(MEMP_PBUF), bench_memp_type(MEMP_TCPIP_MSG_INPKT));
+    LOG("[BENCH] pbuf_alloc POOL %u, RAM %u\n", bench_pbuf(PBUF_POOL, 1500), bench_pbuf(PBUF_RAM, 1500));
+    LOG("[BENCH] tcp loopback %u kB/s\n", bench_tcp());
+    LOG("[BENCH] udp send/recv round trip %u ticks, %s sems, %s\n", bench_rtt(), SYS_SEM_NOTIFY ? "notify" : "queue",
+            LWIP_NETCONN_SEM_PER_THREAD ? "per thread" : "per netconn");
+#if MEMP_STATS
+    for (i = 0; i < MEMP_MAX; i++) {
+        struct stats_mem * m = lwip_stats.memp[i];
+        LOG("[BENCH] %-16s avail %3u max %3u err %u\n", m->name, m->avail, m->max, m->err);
+    }
+#endif
+    (void) i;
+}
+
+#define BENCH_SLOTS         128
+
+/* replays a cJSON-like workload: items, strdup'd keys and values, one big buffer per round, then frees */
+void bench_slab(void) {
+    static void * slot[BENCH_SLOTS];
+    static const uint16_t sizes[] = {40, 12, 40, 24, 40, 8, 40, 160, 40, 17, 40, 64};
+    uint32_t round, i, ops = 0, ticks = 0, start;
+    void * big;
+    for (round = 0; round < 100; round++) {
+        start = ReadCoreTimer();
+        big = pvPortMalloc(1024 + (round & 7) * 128);
+        for (i = 0; i < BENCH_SLOTS; i++)
+            slot[i] = pvPortMalloc(sizes[(i + round) % (sizeof (sizes) / sizeof (sizes[0]))]);
+        vPortFree(big);
+        for (i = 0; i < BENCH_SLOTS; i += 2) // free half out of order, then the rest
+            vPortFree(slot[i]);
+        for (i = 1; i < BENCH_SLOTS; i += 2)
+            vPortFree(slot[i]);
+        ticks += ReadCoreTimer() - start;
+        ops += 2 * (BENCH_SLOTS + 1);
+    }
+    LOG("[BENCH] slab %s, %u ticks per op\n", configUSE_SLAB ? "on" : "off", ticks / ops);
+#if configUSE_SLAB
+    slab_dump();
+#endif
+}
+
+#define BENCH_HEAP_SLOTS    64
+
+/* only present with configUSE_UMM_MALLOC and UMM_LOCK_IRQ in umm_malloc_cfg.h */
+extern unsigned int umm_irq_off_max __attribute__((weak));
+
+/* mixed sizes above the slab classes, freed every other one to leave holes */
+void bench_heap(void) {
+    static void * slot[BENCH_HEAP_SLOTS];
+    uint32_t round, i, t, ops = 0, ticks = 0, max_ticks = 0, start;
+    size_t free_bytes, largest;
+    for (round = 0; round < 50; round++) {
+        for (i = 0; i < BENCH_HEAP_SLOTS; i++) {
+            start = ReadCoreTimer();
+            slot[i] = pvPortMalloc(300 + ((i * 7 + round) % 13) * 100);
+            t = ReadCoreTimer() - start;
+            ticks += t;
+            if (t > max_ticks)
+                max_ticks = t;
+            ops++;
+        }
+        for (i = 0; i < BENCH_HEAP_SLOTS; i += 2)
+            vPortFree(slot[i]);
+        free_bytes = xPortGetFreeHeapSize();
+        largest = xPortGetLargestFreeBlockSize();
+        for (i = 1; i < BENCH_HEAP_SLOTS; i += 2)
+            vPortFree(slot[i]);
+    }
+    LOG("[BENCH] heap %s: malloc avg %u max %u ticks, fragmentation %u%%, min ever free %u\n",
+            configUSE_UMM_MALLOC ? "umm" : "heap_4", ticks / ops, max_ticks,
+            free_bytes ? 100 - (uint32_t) (100ull * largest / free_bytes) : 0,
+            xPortGetMinimumEverFreeHeapSize());
+    if (&umm_irq_off_max)
+        LOG("[BENCH] umm irq off max %u ticks\n", umm_irq_off_max);
+}
+
+#define BENCH_MBOX_POSTS    10000
+#define BENCH_MBOX_WAKES    200
+
+static sys_mbox_t bench_mb;
+static uint32_t bench_mbox_lat, bench_mbox_lat_max, bench_mbox_got;
+
+/* the reader of the tcpip thread: higher priority, woken by every post to an empty mailbox */
+static void bench_mbox_reader(void * arg) {
+    void * msg;
+    uint32_t t;
+    for (;;) {
+        sys_arch_mbox_fetch(&bench_mb, &msg, 0);
+        if (NULL == msg)
+            break;
+        t = ReadCoreTimer() - (uint32_t) msg;
+        bench_mbox_lat += t;
+        if (t > bench_mbox_lat_max)
+            bench_mbox_lat_max = t;
+        bench_mbox_got++;
+    }
+    xTaskNotifyGive((TaskHandle_t) arg);
+    vTaskDelete(NULL);
+}
+
+/* posts per second and post-to-wake latency of the lwIP mailbox, SYS_MBOX_MPSC 1 or 0 in lwipopts.h */
+void bench_mbox(void) {
+    uint32_t i, start, elapsed, lat_avg, lat_max;
+    if (ERR_OK != sys_mbox_new(&bench_mb, TCPIP_MBOX_SIZE))
+        return;
+    if (pdPASS != xTaskCreate(bench_mbox_reader, "MBOX", 512, xTaskGetCurrentTaskHandle(), TASK_PRIORITY_HIGH, NULL)) {
+        sys_mbox_free(&bench_mb);
+        return;
+    }
+    start = ReadCoreTimer();
+    for (i = 0; i < BENCH_MBOX_POSTS; i++)
+        sys_mbox_post(&bench_mb, (void *) (ReadCoreTimer() | 1));
+    elapsed = (ReadCoreTimer() - start) / us_SCALE;
+    bench_mbox_lat = bench_mbox_lat_max = bench_mbox_got = 0;
+    for (i = 0; i < BENCH_MBOX_WAKES; i++) {
+        vTaskDelay(1); // the reader is back asleep
+        sys_mbox_post(&bench_mb, (void *) (ReadCoreTimer() | 1));
+    }
+    lat_avg = bench_mbox_got ? bench_mbox_lat / bench_mbox_got : 0;
+    lat_max = bench_mbox_lat_max;
+    sys_mbox_post(&bench_mb, NULL);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    sys_mbox_free(&bench_mb);
+    LOG("[BENCH] mbox %s: %u posts/s, wake avg %u max %u ticks\n", SYS_MBOX_MPSC ? "mpsc" : "queue",
+            elapsed ? (uint32_t) (BENCH_MBOX_POSTS * 1000000ull / elapsed) : 0, lat_avg, lat_max);
+}
+
+#define BENCH_TIMERS        400
+#define BENCH_TIMERS_RUN    60000   /* virtual ms, checked every 10 ms like a packet stream */
+
+static twheel_node_t bench_tnode[BENCH_TIMERS];
+static twheel_t bench_wheel;
+static twheel_node_t * bench_tlist;
+static uint32_t bench_trand;
+
+static uint32_t bench_tdelay(void) {
+    bench_trand = bench_trand * 1103515245 + 12345;
+    return 10 + (bench_trand >> 8) % 30000;
+}
+
+/* the sorted list of core/timeouts.c, by absolute time to keep it short */
+static void bench_list_add(twheel_node_t * n, uint32_t expire) {
+    twheel_node_t ** pt = &bench_tlist;
+    n->expire = expire;
+    while (*pt && (int32_t) ((*pt)->expire - expire) <= 0)
+        pt = &(*pt)->next;
+    n->next = *pt;
+    *pt = n;
+}
+
+static void bench_list_del(twheel_node_t * n) {
+    twheel_node_t ** pt = &bench_tlist;
+    while (*pt && *pt != n)
+        pt = &(*pt)->next;
+    if (*pt)
+        *pt = n->next;
+}
+
+static void bench_wheel_rearm(twheel_node_t * n, void * ctx) {
+    twheel_add(&bench_wheel, n, bench_wheel.now + bench_tdelay()); // periodic, like cyclic_timer()
+}
+
+/* hundreds of timeouts: add, delete and expire on a virtual clock, wheel against the sorted list */
+void bench_timers(void) {
+    uint32_t i, now, start, add[2], del[2], run[2];
+    twheel_node_t * n;
+    bench_trand = 1;
+    twheel_init(&bench_wheel, 0);
+    start = ReadCoreTimer();
+    for (i = 0; i < BENCH_TIMERS; i++)
+        twheel_add(&bench_wheel, &bench_tnode[i], bench_tdelay());
+    add[0] = (ReadCoreTimer() - start) / BENCH_TIMERS;
+    start = ReadCoreTimer();
+    for (i = 0; i < BENCH_TIMERS; i += 4)
+        twheel_del(&bench_wheel, &bench_tnode[i]);
+    del[0] = (ReadCoreTimer() - start) / (BENCH_TIMERS / 4);
+    start = ReadCoreTimer();
+    for (now = 0; now < BENCH_TIMERS_RUN; now += 10)
+        twheel_advance(&bench_wheel, now, bench_wheel_rearm, NULL);
+    run[0] = (ReadCoreTimer() - start) / us_SCALE;
+
+    bench_trand = 1;
+    bench_tlist = NULL;
+    start = ReadCoreTimer();
+    for (i = 0; i < BENCH_TIMERS; i++)
+        bench_list_add(&bench_tnode[i], bench_tdelay());
+    add[1] = (ReadCoreTimer() - start) / BENCH_TIMERS;
+    start = ReadCoreTimer();
+    for (i = 0; i < BENCH_TIMERS; i += 4)
+        bench_list_del(&bench_tnode[i]);
+    del[1] = (ReadCoreTimer() - start) / (BENCH_TIMERS / 4);
+    start = ReadCoreTimer();
+    for (now = 0; now < BENCH_TIMERS_RUN; now += 10) {
+        while ((n = bench_tlist) && (int32_t) (now - n->expire) >= 0) {
+            bench_tlist = n->next;
+            bench_list_add(n, now + bench_tdelay());
+        }
+    }
+    run[1] = (ReadCoreTimer() - start) / us_SCALE;
+    LOG("[BENCH] %u timers: wheel add %u del %u ticks run %u us, list add %u del %u ticks run %u us\n",
+            BENCH_TIMERS, add[0], del[0], run[0], add[1], del[1], run[1]);
+}
+
+#define BENCH_PINGS         1000
+
+static nsem_t * bench_ping_ns, * bench_pong_ns;
+static SemaphoreHandle_t bench_ping_qs, bench_pong_qs;
+static volatile uint32_t bench_ping_at;
+static uint32_t bench_ping_lat, bench_ping_lat_max;
+
+/* the driver task of the MRF24WN, woken from the ISR and answering right away */
+static void bench_pong(void * arg) {
+    uint32_t i, t;
+    for (i = 0; i < BENCH_PINGS; i++) {
+        if (arg)
+            nsem_take(bench_ping_ns, portMAX_DELAY);
+        else
+            xSemaphoreTake(bench_ping_qs, portMAX_DELAY);
+        t = ReadCoreTimer() - bench_ping_at;
+        bench_ping_lat += t;
+        if (t > bench_ping_lat_max)
+            bench_ping_lat_max = t;
+        if (arg)
+            nsem_give(bench_pong_ns);
+        else
+            xSemaphoreGive(bench_pong_qs);
+    }
+    vTaskDelete(NULL);
+}
+
+/* ping with the give from ISR of OSAL_SEM_PostISR(), pong with a plain give, 1 nsem 0 queue semaphore */
+static uint32_t bench_pingpong(bool nsem) {
+    uint32_t i, start;
+    BaseType_t woken;
+    bench_ping_lat = bench_ping_lat_max = 0;
+    if (pdPASS != xTaskCreate(bench_pong, "PONG", 256, (void *) nsem, TASK_PRIORITY_HIGH, NULL))
+        return 0;
+    start = ReadCoreTimer();
+    for (i = 0; i < BENCH_PINGS; i++) {
+        woken = pdFALSE;
+        bench_ping_at = ReadCoreTimer();
+        if (nsem)
+            nsem_give_from_isr(bench_ping_ns, &woken);
+        else
+            xSemaphoreGiveFromISR(bench_ping_qs, &woken);
+        portEND_SWITCHING_ISR(woken);
+        if (nsem)
+            nsem_take(bench_pong_ns, portMAX_DELAY);
+        else
+            xSemaphoreTake(bench_pong_qs, portMAX_DELAY);
+    }
+    return (ReadCoreTimer() - start) / us_SCALE;
+}
+
+/* give-to-wake latency and round trips of the notification semaphore against the kernel one */
+void bench_nsem(void) {
+    uint32_t elapsed[2], lat[2], lat_max[2];
+    bench_ping_ns = rtos_nsem(1, 0);
+    bench_pong_ns = rtos_nsem(1, 0);
+    bench_ping_qs = rtos_sem_binary();
+    bench_pong_qs = rtos_sem_binary();
+    if (bench_ping_ns && bench_pong_ns && bench_ping_qs && bench_pong_qs) {
+        elapsed[0] = bench_pingpong(true);
+        lat[0] = bench_ping_lat / BENCH_PINGS;
+        lat_max[0] = bench_ping_lat_max;
+        vTaskDelay(1); // PONG is gone
+        elapsed[1] = bench_pingpong(false);
+        lat[1] = bench_ping_lat / BENCH_PINGS;
+        lat_max[1] = bench_ping_lat_max;
+        vTaskDelay(1);
+        LOG("[BENCH] ping-pong nsem: %u/s wake avg %u max %u ticks, queue: %u/s wake avg %u max %u ticks\n",
+                elapsed[0] ? (uint32_t) (BENCH_PINGS * 1000000ull / elapsed[0]) : 0, lat[0], lat_max[0],
+                elapsed[1] ? (uint32_t) (BENCH_PINGS * 1000000ull / elapsed[1]) : 0, lat[1], lat_max[1]);
+    }
+    rtos_nsem_delete(bench_ping_ns);
+    rtos_nsem_delete(bench_pong_ns);
+    rtos_delete(bench_ping_qs);
+    rtos_delete(bench_pong_qs);
+}
+
+#define BENCH_FLOOD_BURST   32      /* packets per ms, twice the input mailbox */
+#define BENCH_FLOOD_COST    20      /* us of tcpip thread per packet */
+#define BENCH_FLOOD_CALLS   200
+
+static volatile bool bench_flood_on;
+static uint32_t bench_flood_sent, bench_flood_lost;
+
+static err_t bench_flood_input(struct pbuf * p, struct netif * inp) {
+    hrtimer_spin_us(BENCH_FLOOD_COST); // ip_input() of a small frame
+    return ERR_OK;
+}
+
+/* the wifi RX task at full speed, no pbufs: the cost is in bench_flood_input() */
+static void bench_flood(void * arg) {
+    uint32_t i;
+    while (bench_flood_on) {
+        for (i = 0; i < BENCH_FLOOD_BURST; i++) {
+            bench_flood_sent++;
+            if (ERR_OK != tcpip_inpkt(NULL, NULL, bench_flood_input))
+                bench_flood_lost++;
+        }
+        vTaskDelay(1);
+    }
+    xTaskNotifyGive((TaskHandle_t) arg);
+    vTaskDelete(NULL);
+}
+
+static void bench_flood_call(void * ctx) {
+    nsem_give((nsem_t *) ctx);
+}
+
+/* tcpip_callback() round trip ( what every socket call pays ) while received packets flood the tcpip thread */
+void bench_tcpip_flood(void) {
+    uint32_t i, t, lat = 0, lat_max = 0, n = 0;
+    nsem_t done;
+    nsem_init(&done, 1, 0);
+    bench_flood_sent = bench_flood_lost = 0;
+    bench_flood_on = true;
+    if (pdPASS != xTaskCreate(bench_flood, "FLOOD", 256, xTaskGetCurrentTaskHandle(), TASK_PRIORITY_RTOS_LOW, NULL))
+        return;
+    for (i = 0; i < BENCH_FLOOD_CALLS; i++) {
+        vTaskDelay(1 + i % 3); // lands anywhere in the burst
+        t = ReadCoreTimer();
+        if (ERR_OK != tcpip_callback(bench_flood_call, &done))
+            continue;
+        nsem_take(&done, portMAX_DELAY);
+        t = (ReadCoreTimer() - t) / us_SCALE;
+        lat += t;
+        if (t > lat_max)
+            lat_max = t;
+        n++;
+    }
+    bench_flood_on = false;
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    LOG("[BENCH] tcpip flood %s: api avg %u max %u us, rx %u lost %u\n", TCPIP_MBOX_SPLIT ? "split" : "single",
+            n ? lat / n : 0, lat_max, bench_flood_sent, bench_flood_lost);
+#if TCPIP_MBOX_SPLIT
+    LOG("[BENCH] tcpip mbox: in %u drop %u, api %u drop %u\n", tcpip_mbox_stats.in_done, tcpip_mbox_stats.in_drop,
+            tcpip_mbox_stats.api_done, tcpip_mbox_stats.api_drop);
+#endif
+}
+
+#define BENCH_CORO_JOBS     16
+#define BENCH_CORO_ROUNDS   20
+#define BENCH_CORO_PORT     5003
+#define BENCH_CORO_TICKS    50      /* of the 10 ms FreeRTOS timer */
+
+typedef struct {
+    coro_t co;                  /* first */
+    uint32_t i;
+    int s;
+} bench_job_t;
+
+static bench_job_t bench_job[BENCH_CORO_JOBS];
+static coro_t bench_echo, bench_tick;
+static int bench_echo_fd = -1;
+static uint32_t bench_coro_left, bench_coro_rtt, bench_coro_ticks;
+static TaskHandle_t bench_coro_waiter;
+
+static int bench_echo_job(coro_t * c) {
+    struct sockaddr_in from;
+    socklen_t len = sizeof (from);
+    char b;
+    CORO_BEGIN(c);
+    while (bench_coro_left) {
+        CORO_WAIT_READ(c, bench_echo_fd, 100);
+        while (lwip_recvfrom(bench_echo_fd, &b, 1, MSG_DONTWAIT, (struct sockaddr *) &from, &len) == 1) {
+            lwip_sendto(bench_echo_fd, &b, 1, 0, (struct sockaddr *) &from, len);
+            len = sizeof (from);
+        }
+    }
+    CORO_END(c);
+}
+
+/* woken by a FreeRTOS timer through coro_timer_cb, the daemon task only notifies */
+static int bench_tick_job(coro_t * c) {
+    CORO_BEGIN(c);
+    while (bench_coro_ticks < BENCH_CORO_TICKS) {
+        CORO_WAIT_SIGNAL(c, 1000);
+        if (0 == (c->ev & CORO_EV_SIGNAL))
+            break;
+        bench_coro_ticks++;
+    }
+    CORO_END(c);
+}
+
+/* a sensor poll or a keep-alive: sleeps, one job also talks to the echo job over loopback */
+static int bench_coro_job(coro_t * c) {
+    bench_job_t * j = (bench_job_t *) c;
+    struct sockaddr_in addr;
+    char b = 'x';
+    CORO_BEGIN(c);
+    for (j->i = 0; j->i < BENCH_CORO_ROUNDS; j->i++) {
+        if (j->s >= 0) {
+            memset(&addr, 0, sizeof (addr));
+            addr.sin_family = AF_INET;
+            addr.sin_port = PP_HTONS(BENCH_CORO_PORT);
+            addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+            lwip_sendto(j->s, &b, 1, 0, (struct sockaddr *) &addr, sizeof (addr));
+            CORO_WAIT_READ(c, j->s, 100);
+            if (c->ev & CORO_EV_READ && lwip_recv(j->s, &b, 1, MSG_DONTWAIT) == 1)
+                bench_coro_rtt++;
+        }
+        CORO_SLEEP(c, 5 + (j - bench_job) % 10);
+    }
+    CORO_END(c);
+}
+
+static void bench_coro_done(coro_t * c) {
+    bench_job_t * j = (bench_job_t *) c;
+    if (j->s >= 0)
+        lwip_close(j->s);
+    if (0 == --bench_coro_left)
+        xTaskNotifyGive(bench_coro_waiter);
+}
+
+static void bench_echo_done(coro_t * c) {
+    xTaskNotifyGive(bench_coro_waiter); // the echo and the tick job
+}
+
+/* dozens of I/O bound jobs in the CORO task, RAM against one task per job */
+void bench_coro(void) {
+    struct sockaddr_in addr;
+    TimerHandle_t timer;
+    uint32_t i;
+    if (!coro_init(TASK_PRIORITY_NORMAL))
+        return;
+    bench_coro_waiter = xTaskGetCurrentTaskHandle();
+    bench_coro_left = BENCH_CORO_JOBS;
+    bench_coro_rtt = 0;
+    bench_coro_ticks = 0;
+    memset(&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = PP_HTONS(BENCH_CORO_PORT);
+    addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+    bench_echo_fd = lwip_socket(AF_INET, SOCK_DGRAM, 0);
+    if (bench_echo_fd < 0 || 0 != lwip_bind(bench_echo_fd, (struct sockaddr *) &addr, sizeof (addr))) {
+        LOG("[BENCH] coro: no echo socket\n");
+        if (bench_echo_fd >= 0)
+            lwip_close(bench_echo_fd);
+        return;
+    }
+    timer = xTimerCreate("CORO", pdMS_TO_TICKS(10), pdTRUE, &bench_tick, coro_timer_cb);
+    coro_start(&bench_tick, bench_tick_job, bench_echo_done);
+    if (timer)
+        xTimerStart(timer, portMAX_DELAY);
+    coro_start(&bench_echo, bench_echo_job, bench_echo_done);
+    for (i = 0; i < BENCH_CORO_JOBS; i++) {
+        bench_job[i].s = i ? -1 : lwip_socket(AF_INET, SOCK_DGRAM, 0); // UDP pcbs are few
+        coro_start(&bench_job[i].co, bench_coro_job, bench_coro_done);
+    }
+    for (i = 0; i < 3; i++)
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY); // the jobs, the echo, the tick job
+    if (timer)
+        xTimerDelete(timer, portMAX_DELAY);
+    lwip_close(bench_echo_fd);
+    LOG("[BENCH] coro: %u jobs, %u loopback round trips, %u/%u timer signals\n",
+            BENCH_CORO_JOBS + 2, bench_coro_rtt, bench_coro_ticks, BENCH_CORO_TICKS);
+    coro_dump(sizeof (bench_job_t), 512);
+}
+
+#define BENCH_SPI_MS        5000
+
+/* MRF24WN SPI over the Wi-Fi traffic of BENCH_SPI_MS, the DMA wait is CPU time for other tasks */
+void bench_spi(void) {
+    mrf_spi_stat_t a, b;
+    uint32_t wire_us;
+    WDRV_SPI_Stat(&a);
+    vTaskDelay(pdMS_TO_TICKS(BENCH_SPI_MS));
+    WDRV_SPI_Stat(&b);
+    wire_us = (uint64_t) (b.dma_bytes - a.dma_bytes + b.polled_bytes - a.polled_bytes) * 8000000 / WF_SPI_SPEED;
+    LOG("[BENCH] spi: dma %u ( %u bytes ) polled %u ( %u bytes ) timeouts %u\n",
+            b.dma - a.dma, b.dma_bytes - a.dma_bytes, b.polled - a.polled, b.polled_bytes - a.polled_bytes,
+            b.timeouts - a.timeouts);
+    LOG("[BENCH] spi: wire %u us, CPU free while DMA %u us\n", wire_us, (uint32_t) (b.wait_us - a.wait_us));
+}
+
+/* Wi-Fi over BENCH_SPI_MS: receive ticks per frame, frames per tcpip message, how close PBUF_POOL came to empty, chains sent */
+void bench_wifi(void) {
+    wifi_rx_stat_t a, b;
+    wifi_tx_stat_t ta, tb;
+    uint32_t frames;
+    WIFI_RxStat(&a);
+    WIFI_TxStat(&ta);
+    vTaskDelay(pdMS_TO_TICKS(BENCH_SPI_MS));
+    WIFI_RxStat(&b);
+    WIFI_TxStat(&tb);
+    frames = b.frames - a.frames;
+    LOG("[BENCH] wifi rx: %u frames %u bytes, %u ticks per frame, invalid %u nomem %u\n",
+            frames, b.bytes - a.bytes, frames ? (b.cycles - a.cycles) / frames : 0,
+            b.invalid - a.invalid, b.nomem - a.nomem);
+#if MEMP_STATS
+    LOG("[BENCH] wifi rx: PBUF_POOL avail %u max %u err %u\n", lwip_stats.memp[MEMP_PBUF_POOL]->avail,
+            lwip_stats.memp[MEMP_PBUF_POOL]->max, lwip_stats.memp[MEMP_PBUF_POOL]->err);
+#endif
+    LOG("[BENCH] wifi rx: %u tcpip messages, bursts of 1 %u, 2 %u, 3-4 %u, 5-8 %u, 9-16 %u, 17+ %u, overrun %u, no message %u\n",
+            b.bursts - a.bursts, b.batch[0] - a.batch[0], b.batch[1] - a.batch[1], b.batch[2] - a.batch[2],
+            b.batch[3] - a.batch[3], b.batch[4] - a.batch[4], b.batch[5] - a.batch[5], b.overrun - a.overrun, b.nomsg - a.nomsg);
+    LOG("[BENCH] wifi tx: %u frames %u bytes, %u chains gathered, err %u\n",
+            tb.frames - ta.frames, tb.bytes - ta.bytes, tb.gathered - ta.gathered, tb.err - ta.err);
+}
+
+static const char * const bench_rxf_rule[MRF_RXF_MAX] = {
+    "pass", "runt", "not us", "ethertype", "arp other", "bcast proto", "bcast port"
+};
+
+/* one broadcast frame of the office noise, IPv4 UDP or ARP */
+static uint32_t bench_rxf_frame(uint8_t * f, uint16_t type, uint8_t proto, uint16_t port, uint32_t arp_target) {
+    memset(f, 0, 64);
+    memset(f, 0xFF, 6);
+    f[12] = type >> 8;
+    f[13] = type;
+    if (0x0806 == type) {
+        f[14 + 7] = 1; // request
+        memcpy(f + 14 + 24, &arp_target, 4);
+    } else {
+        f[14] = 0x45;
+        f[14 + 9] = proto;
+        f[14 + 20 + 2] = port >> 8;
+        f[14 + 20 + 3] = port;
+    }
+    return 60;
+}
+
+/* replays broadcast noise ( ARP for others, NetBIOS, SSDP, LLMNR, Dropbox, IGMP ) and a few wanted frames */
+void bench_rxf(void) {
+    static const struct {
+        uint16_t type;
+        uint8_t proto;
+        uint16_t port;
+        bool arp_us;
+    } mix[] = {
+        {0x0806, 0, 0, false}, {0x0806, 0, 0, false}, {0x0806, 0, 0, false}, {0x0806, 0, 0, true},
+        {0x0800, 17, 137, false}, {0x0800, 17, 138, false}, {0x0800, 17, 1900, false}, {0x0800, 17, 5355, false},
+        {0x0800, 17, 17500, false}, {0x0800, 2, 0, false}, {0x0800, 17, 68, false}, {0x86DD, 17, 5353, false},
+    };
+    uint8_t frame[64];
+    mrf_rxf_stat_t st; // local, the driver task keeps counting live frames in the filter's own
+    uint32_t i, r, len, ip = ip4_addr_get_u32(netif_ip4_addr(&wlan)), t;
+    memset(&st, 0, sizeof (st));
+    t = ReadCoreTimer();
+    for (r = 0; r < 1000; r++)
+        for (i = 0; i < sizeof (mix) / sizeof (mix[0]); i++) {
+            len = bench_rxf_frame(frame, mix[i].type, mix[i].proto, mix[i].port, mix[i].arp_us ? ip : ip ^ PP_HTONL(0xFF));
+            st.rule[mrf_rxf_verdict(frame, len, wlan.hwaddr, ip)]++;
+        }
+    t = ReadCoreTimer() - t;
+    LOG("[BENCH] rx filter: %u frames, %u ticks per frame\n", r * i, t / (r * i));
+    for (i = 0; i < MRF_RXF_MAX; i++)
+        LOG("[BENCH] rx filter: %-12s %u\n", bench_rxf_rule[i], st.rule[i]);
+}
+
+static void entryBENCH(void * arg) {
+    (void) arg;
+    bench_heap();
+    bench_realloc();
+    bench_slab();
+    bench_memp();
+    bench_mbox();
+    bench_nsem();
+    bench_tcpip_flood();
+    bench_coro();
+    bench_spi();
+    bench_wifi();
+    bench_rxf();
+    bench_timers();
+    lwip_socket_thread_cleanup();
+    vTaskDelete(NULL);
+}
+
+void bench_run(void) {
+    xTaskCreate(entryBENCH, "BENCH", 1024, NULL, TASK_PRIORITY_NORMAL, NULL);
+}
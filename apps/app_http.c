@@ -7,6 +7,7 @@
 #include "osal.h"
 #include "mrf.h"
 #include "httpclient.h"
+#include "heap_trace.h"
 
 /* HTTP Client is blocked */
 
@@ -27,7 +28,7 @@ void entryHTTP(void * arg) {
     LOG("[HTTP] BEGIN\n");
     WIFI_waitReady();
     static uint32_t index = 0;
-    uint32_t startTime, elapsed;
+    uint32_t startTime, elapsed, peak;
     httpclient_t client = {0};
     httpclient_data_t client_data = {0};
     //LOG("[START] uxTaskGetStackHighWaterMark:     %u\n", uxTaskGetStackHighWaterMark(NULL));
@@ -42,9 +43,11 @@ startTime = xTaskGetTickCount();
     //client_data.header_buf_len = RES_BUF_SIZE;
     client_data.response_buf = response;
     client_data.response_buf_len = RES_BUF_SIZE;
+    heap_trace_begin();
     httpclient_get(&client, url[index % URL_COUNT], &client_data);
 elapsed = (xTaskGetTickCount() - startTime) * portTICK_PERIOD_MS;
-    LOG("[HTTP] Elapsed: %u mSec\n", elapsed);
+    peak = heap_trace_end();
+    LOG("[HTTP] Elapsed: %u mSec, Heap peak: %u\n", elapsed, peak);
     //LOG("[HTTP] Header: %s\n", client_data.header_buf);
     LOG("[HTTP] Receive: %s\n\n", client_data.response_buf);
     
@@ -52,6 +55,7 @@ elapsed = (xTaskGetTickCount() - startTime) * portTICK_PERIOD_MS;
     //LOG("[RTOS] xPortGetFreeHeapSize:            %u\n", xPortGetFreeHeapSize());
     //LOG("[RTOS] uxTaskGetStackHighWaterMark:     %u\n", uxTaskGetStackHighWaterMark(NULL));
     //LOG("[RTOS] xPortGetMinimumEverFreeHeapSize: %u\n", xPortGetMinimumEverFreeHeapSize());    
+    heap_trace_dump();
         
     delay_ms(10 * 1000); 
     index++;
@@ -5,10 +5,16 @@
 
 #include "mrf.h"
 #include "osal.h"
+#include "lwip/tcpip.h"
+#include "mrf_filter.h"
 
 struct netif wlan;
+static struct netif * wifi_netif; /* set once by netif_add, the RX path never looks it up */
+static wifi_rx_stat_t rx_stat;
+static wifi_tx_stat_t tx_stat;
+static uint8_t wifi_tx_buf[MRF_MAX_PACKET_SIZE]; /* chains only, linkoutput runs in the tcpip core */
 static err_t wifi_send(struct netif * interface, struct pbuf * pb);
-static void wifi_receive(struct netif * interface, struct pbuf * pb);
+static void wifi_receive(struct pbuf * pb);
 static void wifi_set_state(bool connected);
 static bool wifi_ready = false;
 static bool wifi_started = false;
@@ -76,17 +82,39 @@ static void InitDoneCB(void) {
     WDRV_Connect();
 }
 
+/*
+ * The library frees its netbuf when this returns ( Custom_DeliverFrameToNetworkStack ),
+ * the frame can not be lent to lwIP: one copy into one pool pbuf ( PBUF_POOL_BUFSIZE holds a frame )
+ */
 static void ReceiveCB(uint32_t len, uint8_t const *const frame) {
-    if (!WDRV_isPacketValid(frame))
+    uint32_t start = ReadCoreTimer();
+    struct pbuf * pb;
+    if (!WDRV_isPacketValid(frame)) {
+        rx_stat.invalid++;
         return;
-    //LOG("[MRF] ReceiveCB()\n");  
-    struct pbuf * pb = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
-    if (pb) {
-        pbuf_take(pb, frame, len);
-        wifi_receive(&wlan, pb);
-    } else {
-        LOG_ERROR();
     }
+    if (MRF_RXF_PASS != mrf_rxf_check(frame, len, wlan.hwaddr, ip4_addr_get_u32(netif_ip4_addr(&wlan))))
+        return; // broadcast noise never takes a pool pbuf, counted per rule
+    //LOGI("[MRF] ReceiveCB( %u )\n", len);  
+    pb = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+    if (NULL == pb) {
+        rx_stat.nomem++; // no LOG here, a flood would stall on the UART
+        LINK_STATS_INC(link.memerr);
+        LINK_STATS_INC(link.drop);
+        return;
+    }
+    if (pb->next)
+        pbuf_take(pb, frame, len);
+    else
+        MEMCPY(pb->payload, frame, len);
+    rx_stat.frames++;
+    rx_stat.bytes += len;
+    wifi_receive(pb);
+    rx_stat.cycles += ReadCoreTimer() - start;
+}
+
+void WIFI_RxStat(wifi_rx_stat_t * stat) {
+    if (stat) *stat = rx_stat;
 }
 
 static void ConnectionStateUpdate(bool connected, uint8_t reason) {
@@ -149,37 +177,132 @@ void WDRV_Init(void) {
 
 // NETIF ///////////////////////////////////////////////////////////////////////
 
+/*
+ * WDRV_EXT_DataSend() copies the frame into a library netbuf before it returns,
+ * a single pbuf goes as it is, a chain is gathered once into wifi_tx_buf
+ * The caller owns pb in any case
+ */
 err_t wifi_send(struct netif * interface, struct pbuf * pb) {
+    uint8_t * frame;
     if (!pb) return ERR_ARG;
-    struct netif * netif;
-    for (netif = netif_list; (netif != NULL) && (netif->state != (void*) interface); netif = netif->next);
-    if (netif == NULL) {
-        pbuf_free(pb);
-        pb = NULL;
+    if (pb->tot_len > sizeof (wifi_tx_buf)) {
+        tx_stat.err++;
+        LINK_STATS_INC(link.lenerr);
+        LINK_STATS_INC(link.drop);
         return ERR_IF;
     }
-    if (WDRV_EXT_DataSend(pb->len, pb->payload)) {
-        LWIP_ASSERT("MRF-TX", 1);
+    if (pb->next) {
+        pbuf_copy_partial(pb, wifi_tx_buf, pb->tot_len, 0);
+        frame = wifi_tx_buf;
+        tx_stat.gathered++;
+    } else {
+        frame = pb->payload;
+    }
+    if (WDRV_EXT_DataSend(pb->tot_len, frame)) {
+        tx_stat.err++;
+        LINK_STATS_INC(link.err);
         return ERR_IF;
     }
-    return 0;
+    tx_stat.frames++;
+    tx_stat.bytes += pb->tot_len;
+    LINK_STATS_INC(link.xmit);
+    return ERR_OK;
 }
 
-void wifi_receive(struct netif * interface, struct pbuf * pb) {
+void WIFI_TxStat(wifi_tx_stat_t * stat) {
+    if (stat) *stat = tx_stat;
+}
+
+#if MRF_RX_BATCH_MAX > 1
+/*
+ * Frames wait in rx_ring ( driver task puts, tcpip_thread takes ) and one TCPIP_MSG_INPKT
+ * is posted per burst: the first frame posts, the next ones only join until tcpip_thread runs
+ * rx_posted is cleared before the last look at the ring, so a frame is never left without a message
+ */
+static struct pbuf * rx_ring[MRF_RX_RING];
+static volatile uint32_t rx_head, rx_tail;
+static volatile uint32_t rx_posted;
+
+static err_t wifi_input_burst(struct pbuf * unused, struct netif * netif);
+
+/*
+ * No message for a burst ( mailbox full, no TCPIP_MSG_INPKT ): the caller holds rx_posted with no
+ * burst queued, so it owns the ring tail and drops the frames, else they would wait for the next frame
+ * A frame put meanwhile found rx_posted set, the loop posts for it
+ */
+static void wifi_post_burst(struct netif * netif) {
+    while (0 == __sync_lock_test_and_set(&rx_posted, 1)) {
+        if (ERR_OK == tcpip_inpkt(NULL, netif, wifi_input_burst))
+            return;
+        while (rx_tail != rx_head) {
+            __sync_synchronize();
+            pbuf_free(rx_ring[rx_tail & (MRF_RX_RING - 1)]);
+            __sync_synchronize();
+            rx_tail++;
+            rx_stat.nomsg++;
+            LINK_STATS_INC(link.drop);
+        }
+        __sync_lock_release(&rx_posted);
+        __sync_synchronize();
+        if (rx_tail == rx_head)
+            return;
+    }
+}
+
+/* tcpip_thread */
+static err_t wifi_input_burst(struct pbuf * unused, struct netif * netif) {
+    struct pbuf * pb;
+    uint32_t n = 0;
+    while (rx_tail != rx_head && n < MRF_RX_BATCH_MAX) {
+        __sync_synchronize();
+        pb = rx_ring[rx_tail & (MRF_RX_RING - 1)];
+        __sync_synchronize();
+        rx_tail++;
+        n++;
+        LINK_STATS_INC(link.recv);
+        if (netif->input(pb, netif))
+            pbuf_free(pb);
+    }
+    rx_stat.bursts++;
+    rx_stat.batch[(n <= 1) ? 0 : (n > 16) ? 5 : 32 - __builtin_clz(n - 1)]++;
+    __sync_lock_release(&rx_posted);
+    __sync_synchronize();
+    if (rx_tail != rx_head)
+        wifi_post_burst(netif); // more than MRF_RX_BATCH_MAX or joined meanwhile, API messages go first
+    return ERR_OK;
+}
+#endif
+
+/* driver task */
+void wifi_receive(struct pbuf * pb) {
+    struct netif * netif = wifi_netif;
     if (!pb) return;
-    struct netif * netif;
-    for (netif = netif_list; (netif != NULL) && (netif->state != (void*) interface); netif = netif->next);
     if (netif == NULL) {
         pbuf_free(pb);
         pb = NULL;
         LINK_STATS_INC(link.drop);
         return;
     }
+#if MRF_RX_BATCH_MAX > 1
+    if (rx_head - rx_tail >= MRF_RX_RING) {
+        rx_stat.overrun++;
+        LINK_STATS_INC(link.drop);
+        pbuf_free(pb);
+        return;
+    }
+    rx_ring[rx_head & (MRF_RX_RING - 1)] = pb;
+    __sync_synchronize();
+    rx_head++;
+    __sync_synchronize();
+    wifi_post_burst(netif);
+#else
     LINK_STATS_INC(link.recv);
-    if (netif->input(pb, netif)) {
+    if (tcpip_inpkt(pb, netif, netif->input)) {
+        LINK_STATS_INC(link.drop);
         pbuf_free(pb);
         pb = NULL;
     }
+#endif
 }
 
 static void dhcp_ip_ready_callback(struct netif * netif) {
@@ -223,6 +346,8 @@ static err_t wifi_low_level_init(struct netif * netif) {
     netif->mtu = MRF_MAX_PACKET_SIZE;
     netif->hwaddr_len = ETHARP_HWADDR_LEN;
     netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP;
+    wifi_netif = netif;
+    mrf_rxf_init();
     WDRV_Init();
     return ERR_OK;
 }
@@ -251,11 +376,11 @@ static wifi_conf_t cfg;
 static void entryWifiApp(void * user) {
     if (!user) goto END;
     LOG("[WIFI] BEGIN\n");
-    sem_wifi_connected = xSemaphoreCreateBinary();
+    sem_wifi_connected = rtos_sem_binary();
     if (!sem_wifi_connected) {
         LOG("[ERROR] create sem_wifi_connected\n");
     }
-    sem_wifi_ip_ready = xSemaphoreCreateBinary();
+    sem_wifi_ip_ready = rtos_sem_binary();
     if (!sem_wifi_ip_ready) {
         LOG("[ERROR] create sem_wifi_ip_ready\n");
     }
@@ -280,7 +405,7 @@ void WIFI_Start(const char * str_ip, const char * str_gw, const char * str_mask)
     cfg.str_ip = str_ip;
     cfg.str_gw = str_gw;
     cfg.str_mask = str_mask;
-    xTaskCreate(entryWifiApp, "WiFiApp", 512, &cfg, TASK_PRIORITY_NORMAL, NULL);
+    rtos_task_create(entryWifiApp, "WiFiApp", 512, &cfg, TASK_PRIORITY_NORMAL, NULL);
 }
 
 void WIFI_waitReady(void) {
@@ -21,6 +21,8 @@ extern "C" {
 #define MAX_IP_PACKET_SIZE                      1564 /* including header ??? */
 #define MRF_MAX_PACKET_SIZE                     1518
 #define MAX_MULTICAST_FILTER_SIZE               16
+#define MRF_RX_BATCH_MAX                        16 /* frames per tcpip message, 1 is a message per frame */
+#define MRF_RX_RING                             32 /* power of 2, frames waiting for tcpip_thread */
 
 /* for INFRASTRUCTURE  */    
 //#define WDRV_DEFAULT_SSID                       "Comet Guest Room"    
@@ -170,6 +172,27 @@ extern struct netif wlan;
 void WIFI_Start(const char * str_ip, const char * str_gw, const char * str_mask);
 void WIFI_waitReady(void);
 
+typedef struct {
+    uint32_t frames, bytes;         /* handed to lwIP */
+    uint32_t invalid;               /* not for us, WDRV_isPacketValid() */
+    uint32_t nomem;                 /* no pool pbuf, dropped */
+    uint32_t cycles;                /* core timer ticks of the receive callback */
+    uint32_t overrun;               /* RX ring full, dropped */
+    uint32_t nomsg;                 /* no tcpip message for the burst, the ring dropped */
+    uint32_t bursts;                /* tcpip messages, frames / bursts is the batch size */
+    uint32_t batch[6];              /* bursts of 1, 2, 3-4, 5-8, 9-16, 17+ frames */
+} wifi_rx_stat_t;
+
+void WIFI_RxStat(wifi_rx_stat_t * stat);
+
+typedef struct {
+    uint32_t frames, bytes;         /* taken by WDRV_EXT_DataSend() */
+    uint32_t gathered;              /* pbuf chains copied into one frame */
+    uint32_t err;                   /* too long or refused by the driver */
+} wifi_tx_stat_t;
+
+void WIFI_TxStat(wifi_tx_stat_t * stat);
+
 #include "mrf_api.h"
 
 #ifdef	__cplusplus
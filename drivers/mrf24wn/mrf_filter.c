@@ -0,0 +1,129 @@
+/*
+ *  RX filter, see mrf_filter.h
+ *  Only header bytes are read, the tables are small and scanned linearly
+ *  An IPv4 fragment past the first has no UDP header and passes
+ */
+
+#include "mrf_filter.h"
+#include <string.h>
+
+#define ETH_HLEN                    14
+#define ETH_TYPE_IP                 0x0800
+#define ETH_TYPE_ARP                0x0806
+#define ARP_LEN                     28
+#define ARP_OP_REQUEST              1
+#define IP_HLEN_MIN                 20
+#define IP_PROTO_UDP                17
+#define UDP_PORT_DHCP_CLIENT        68
+
+static bool rxf_on;
+static uint16_t rxf_type[MRF_RXF_TYPES];
+static uint16_t rxf_port[MRF_RXF_PORTS];
+static mrf_rxf_stat_t rxf_stat;
+
+static inline uint16_t rd16(const uint8_t * p) {
+    return (p[0] << 8) | p[1];
+}
+
+static bool rxf_find(const uint16_t * table, int size, uint16_t v) {
+    int i;
+    for (i = 0; i < size; i++)
+        if (table[i] == v)
+            return true;
+    return false;
+}
+
+/* 0 is a free slot */
+static bool rxf_add(uint16_t * table, int size, uint16_t v) {
+    int i;
+    if (0 == v || rxf_find(table, size, v))
+        return v != 0;
+    for (i = 0; i < size; i++)
+        if (0 == table[i]) {
+            table[i] = v;
+            return true;
+        }
+    return false;
+}
+
+void mrf_rxf_init(void) {
+    memset(rxf_type, 0, sizeof (rxf_type));
+    memset(rxf_port, 0, sizeof (rxf_port));
+    rxf_add(rxf_type, MRF_RXF_TYPES, ETH_TYPE_IP);
+    rxf_add(rxf_type, MRF_RXF_TYPES, ETH_TYPE_ARP);
+    rxf_add(rxf_port, MRF_RXF_PORTS, UDP_PORT_DHCP_CLIENT);
+    rxf_on = true;
+}
+
+void mrf_rxf_enable(bool enable) {
+    rxf_on = enable;
+}
+
+bool mrf_rxf_type_add(uint16_t type) {
+    return rxf_add(rxf_type, MRF_RXF_TYPES, type);
+}
+
+bool mrf_rxf_port_add(uint16_t port) {
+    return rxf_add(rxf_port, MRF_RXF_PORTS, port);
+}
+
+bool mrf_rxf_port_del(uint16_t port) {
+    int i;
+    for (i = 0; i < MRF_RXF_PORTS; i++)
+        if (port && rxf_port[i] == port) {
+            rxf_port[i] = 0;
+            return true;
+        }
+    return false;
+}
+
+static int rxf_group(const uint8_t * frame, uint32_t len, uint16_t type, uint32_t ip) {
+    const uint8_t * h = frame + ETH_HLEN;
+    uint32_t ihl;
+    if (ETH_TYPE_ARP == type) {
+        if (len < ETH_HLEN + ARP_LEN)
+            return MRF_RXF_RUNT;
+        if (ARP_OP_REQUEST != rd16(h + 6) || 0 == ip || 0 == memcmp(h + 24, &ip, 4))
+            return MRF_RXF_PASS; // replies, gratuitous ARP, requests for us
+        return MRF_RXF_ARP_OTHER;
+    }
+    if (ETH_TYPE_IP != type)
+        return MRF_RXF_PASS; // an allowlisted ethertype the filter does not parse
+    if (len < ETH_HLEN + IP_HLEN_MIN)
+        return MRF_RXF_RUNT;
+    if (IP_PROTO_UDP != h[9])
+        return MRF_RXF_BCAST_PROTO;
+    if (rd16(h + 6) & 0x1FFF)
+        return MRF_RXF_PASS; // fragment offset, no UDP header here
+    ihl = (h[0] & 0x0F) * 4;
+    if (len < ETH_HLEN + ihl + 4)
+        return MRF_RXF_RUNT;
+    return rxf_find(rxf_port, MRF_RXF_PORTS, rd16(h + ihl + 2)) ? MRF_RXF_PASS : MRF_RXF_BCAST_PORT;
+}
+
+int mrf_rxf_verdict(const uint8_t * frame, uint32_t len, const uint8_t * mac, uint32_t ip) {
+    uint16_t type;
+    int rule;
+    if (!rxf_on) {
+        rule = MRF_RXF_PASS;
+    } else if (len < ETH_HLEN) {
+        rule = MRF_RXF_RUNT;
+    } else if (!rxf_find(rxf_type, MRF_RXF_TYPES, type = rd16(frame + 12))) {
+        rule = MRF_RXF_ETHERTYPE;
+    } else if (frame[0] & 0x01) {
+        rule = rxf_group(frame, len, type, ip); // broadcast, multicast
+    } else {
+        rule = memcmp(frame, mac, 6) ? MRF_RXF_NOT_US : MRF_RXF_PASS;
+    }
+    return rule;
+}
+
+int mrf_rxf_check(const uint8_t * frame, uint32_t len, const uint8_t * mac, uint32_t ip) {
+    int rule = mrf_rxf_verdict(frame, len, mac, ip);
+    rxf_stat.rule[rule]++;
+    return rule;
+}
+
+void mrf_rxf_stat(mrf_rxf_stat_t * stat) {
+    if (stat) *stat = rxf_stat;
+}
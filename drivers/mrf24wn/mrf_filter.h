@@ -0,0 +1,53 @@
+/*
+ *  RX filter on the raw Ethernet frame, before ReceiveCB takes a pool pbuf
+ *  Unicast for us: ethertype allowlist only
+ *  Broadcast and multicast: ARP requests for our IP, IPv4 UDP to an allowlisted port
+ *  Until DHCP gives an address every ARP passes
+ */
+
+#ifndef MRF_FILTER_H
+#define	MRF_FILTER_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MRF_RXF_TYPES               4       /* ethertype allowlist */
+#define MRF_RXF_PORTS               8       /* broadcast / multicast UDP port allowlist */
+
+/* verdict, index of the drop counter */
+enum {
+    MRF_RXF_PASS = 0,
+    MRF_RXF_RUNT,                   /* shorter than the headers it needs */
+    MRF_RXF_NOT_US,                 /* unicast to another MAC */
+    MRF_RXF_ETHERTYPE,              /* not in the ethertype allowlist */
+    MRF_RXF_ARP_OTHER,              /* broadcast ARP request for another host */
+    MRF_RXF_BCAST_PROTO,            /* broadcast / multicast IPv4, not UDP */
+    MRF_RXF_BCAST_PORT,             /* broadcast / multicast UDP to a port not allowed */
+    MRF_RXF_MAX
+};
+
+typedef struct {
+    uint32_t rule[MRF_RXF_MAX];     /* [MRF_RXF_PASS] passed, the others dropped */
+} mrf_rxf_stat_t;
+
+void mrf_rxf_init(void);            /* IPv4 and ARP, DHCP client port */
+void mrf_rxf_enable(bool enable);   /* off: every frame passes, the counters stay */
+bool mrf_rxf_type_add(uint16_t type);
+bool mrf_rxf_port_add(uint16_t port);
+bool mrf_rxf_port_del(uint16_t port);
+
+/* driver task, frame is the raw Ethernet frame, mac and ip ( network order ) of the interface */
+int mrf_rxf_check(const uint8_t * frame, uint32_t len, const uint8_t * mac, uint32_t ip);
+int mrf_rxf_verdict(const uint8_t * frame, uint32_t len, const uint8_t * mac, uint32_t ip); /* not counted */
+
+void mrf_rxf_stat(mrf_rxf_stat_t * stat);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MRF_FILTER_H */
@@ -5,6 +5,8 @@
 
 #include "mrf_hal.h"
 
+static mrf_spi_stat_t spi_stat;
+
 static inline __attribute__((__always_inline__)) void SPI3_WaitForDataByte(void) {
     while ((SPI3STAT & _SPI3STAT_SPITBF_MASK) || (!(SPI3STAT & _SPI3STAT_SPIRBF_MASK)));
 }
@@ -25,6 +27,153 @@ static void SPI3_Read(uint8_t * buf, uint16_t size) {
     }
 }
 
+#ifdef WF_USE_DMA
+#include "fan_int.h"
+#include "nsem.h"
+#include "sys_hrtimer.h"
+
+/*
+ * DMA1 moves SPI3BUF to the buffer on SPI3 RX, DMA2 the buffer to SPI3BUF on SPI3 TX empty
+ * Both run over the same coherent buffer: byte i is received only after it was sent,
+ * so a write is sent from it and a read is clocked out of 0xFF filled bytes
+ * The DMA1 block done ends the transfer, the calling task sleeps on spi_dma_done meanwhile
+ */
+static uint8_t __attribute__((coherent, aligned(4))) spi_dma_buf[WF_SPI_DMA_MAX];
+static nsem_t spi_dma_done;
+
+static void SPI3_DmaInit(void) {
+    DMACONSET = _DMACON_ON_MASK;
+    DCH1CON = 3 << _DCH1CON_CHPRI_POSITION; // RX first, no overrun
+    DCH1ECON = (_SPI3_RX_VECTOR << _DCH1ECON_CHSIRQ_POSITION) | _DCH1ECON_SIRQEN_MASK;
+    DCH1SSA = KVA_TO_PA(&SPI3BUF);
+    DCH1DSA = KVA_TO_PA(spi_dma_buf);
+    DCH1SSIZ = 1;
+    DCH1CSIZ = 1;
+    DCH1INTCLR = 0x00FF00FF;
+    DCH1INTSET = _DCH1INT_CHBCIE_MASK;
+    DCH2CON = 2 << _DCH2CON_CHPRI_POSITION;
+    DCH2ECON = (_SPI3_TX_VECTOR << _DCH2ECON_CHSIRQ_POSITION) | _DCH2ECON_SIRQEN_MASK;
+    DCH2SSA = KVA_TO_PA(spi_dma_buf);
+    DCH2DSA = KVA_TO_PA(&SPI3BUF);
+    DCH2DSIZ = 1;
+    DCH2CSIZ = 1;
+    DCH2INTCLR = 0x00FF00FF;
+    nsem_init(&spi_dma_done, 1, 0);
+    mDMA1SetIntPriority(WF_DMA_PRIO);
+    mDMA1ClearIntFlag();
+    mDMA1IntEnable(1);
+}
+
+/* a task with the scheduler running, else the polled loops */
+static inline bool SPI3_DmaAllowed(uint16_t size) {
+    return size >= WF_SPI_DMA_MIN && 0 == uxInterruptNesting &&
+            taskSCHEDULER_RUNNING == xTaskGetSchedulerState();
+}
+
+/*
+ * size bytes of spi_dma_buf out and back in, false on a timeout:
+ * the channels are stopped once the bytes already queued are on the wire, done bytes went out
+ * and came back into spi_dma_buf, the caller polls the rest of the chunk
+ */
+static bool SPI3_DmaXfer(uint16_t size, uint16_t * done) {
+    uint64_t start = hrtimer_us();
+    nsem_try(&spi_dma_done); // late done of an aborted transfer
+    DCH1DSIZ = size;
+    DCH2SSIZ = size;
+    DCH1INTCLR = _DCH1INT_CHBCIF_MASK;
+    IFS4CLR = _IFS4_SPI3RXIF_MASK | _IFS4_SPI3TXIF_MASK;
+    DCH1CONSET = _DCH1CON_CHEN_MASK;
+    DCH2CONSET = _DCH2CON_CHEN_MASK;
+    DCH2ECONSET = _DCH2ECON_CFORCE_MASK; // the first byte, TX empty starts the next
+    if (nsem_take(&spi_dma_done, pdMS_TO_TICKS(size * 8000UL / WF_SPI_SPEED) + 2)) {
+        spi_stat.dma++;
+        spi_stat.dma_bytes += size;
+        spi_stat.wait_us += hrtimer_us() - start;
+        *done = size;
+        return true;
+    }
+    DCH2CONCLR = _DCH2CON_CHEN_MASK; // no new byte out
+    while (!(SPI3STAT & _SPI3STAT_SPITBE_MASK) || (SPI3STAT & _SPI3STAT_SPIBUSY_MASK));
+    DCH1CONCLR = _DCH1CON_CHEN_MASK; // a suspended channel keeps its pointer
+    *done = DCH1DPTR;
+    while (SPI3STAT & _SPI3STAT_SPIRBF_MASK) {
+        uint8_t b = SPI3BUF; // the last byte out, not moved by DMA1
+        if (*done < size)
+            spi_dma_buf[(*done)++] = b;
+    }
+    DCH2ECONSET = _DCH2ECON_CABORT_MASK;
+    DCH1ECONSET = _DCH1ECON_CABORT_MASK;
+    spi_stat.timeouts++;
+    spi_stat.polled_bytes += size - *done;
+    return false;
+}
+
+static void SPI3_DmaWrite(uint8_t * buf, uint16_t size) {
+    uint16_t n, done;
+    while (size) {
+        n = (size > WF_SPI_DMA_MAX) ? WF_SPI_DMA_MAX : size;
+        memcpy(spi_dma_buf, buf, n);
+        if (!SPI3_DmaXfer(n, &done))
+            SPI3_Write(buf + done, n - done);
+        buf += n;
+        size -= n;
+    }
+}
+
+static void SPI3_DmaRead(uint8_t * buf, uint16_t size) {
+    uint16_t n, done;
+    while (size) {
+        n = (size > WF_SPI_DMA_MAX) ? WF_SPI_DMA_MAX : size;
+        memset(spi_dma_buf, 0xFF, n);
+        if (!SPI3_DmaXfer(n, &done))
+            SPI3_Read(buf + done, n - done); // only the bytes DMA1 stored are copied below
+        memcpy(buf, spi_dma_buf, done);
+        buf += n;
+        size -= n;
+    }
+}
+
+/* mrf_isr.S */
+void ISR_MRF24WN_DMA(void) {
+    BaseType_t woken = pdFALSE;
+    traceISR_ENTER(_DMA1_VECTOR);
+    DCH1INTCLR = _DCH1INT_CHBCIF_MASK;
+    mDMA1ClearIntFlag();
+    nsem_give_from_isr(&spi_dma_done, &woken);
+    traceISR_EXIT(_DMA1_VECTOR);
+    portEND_SWITCHING_ISR(woken);
+}
+#else
+#define SPI3_DmaInit()
+#define SPI3_DmaAllowed(size)       false
+#define SPI3_DmaWrite(buf, size)
+#define SPI3_DmaRead(buf, size)
+#endif /* WF_USE_DMA */
+
+static void SPI3_Out(uint8_t * buf, uint16_t size) {
+    if (SPI3_DmaAllowed(size)) {
+        SPI3_DmaWrite(buf, size);
+        return;
+    }
+    spi_stat.polled++;
+    spi_stat.polled_bytes += size;
+    SPI3_Write(buf, size);
+}
+
+static void SPI3_In(uint8_t * buf, uint16_t size) {
+    if (SPI3_DmaAllowed(size)) {
+        SPI3_DmaRead(buf, size);
+        return;
+    }
+    spi_stat.polled++;
+    spi_stat.polled_bytes += size;
+    SPI3_Read(buf, size);
+}
+
+void WDRV_SPI_Stat(mrf_spi_stat_t * stat) {
+    if (stat) *stat = spi_stat;
+}
+
 static void GPIO_OutLow(uint32_t channel, uint32_t bit_pos) {
     //s_GPIOOutLow(channel, bit_pos);
 }
@@ -62,7 +211,7 @@ bool WDRV_InHibernateMode(void) {
 void WDRV_SPI_Out(uint8_t * const OutBuf, uint16_t OutSize) {
     WD_INT_DISABLE();
     WD_CS_LO();
-    SPI3_Write(OutBuf, OutSize);
+    SPI3_Out(OutBuf, OutSize);
     WD_CS_HI();
     WD_INT_ENABLE();
 }
@@ -71,9 +220,9 @@ void WDRV_SPI_In(uint8_t * const OutBuf, uint16_t OutSize, uint8_t * const InBuf
     WD_INT_DISABLE();
     WD_CS_LO();
     if (OutSize > 0)
-        SPI3_Write(OutBuf, OutSize);
+        SPI3_Out(OutBuf, OutSize);
     if (InSize > 0)
-        SPI3_Read(InBuf, InSize);
+        SPI3_In(InBuf, InSize);
     WD_CS_HI();
     WD_INT_ENABLE();
 }
@@ -99,7 +248,11 @@ void WDRV_SPI_Init(void) {
     for (i = 0; i < 16; i++) dumy = SPI3BUF;
     SPI3BRG = spi_calutate_brg(SYS_CLK_BUS_PERIPHERAL_1, WF_SPI_SPEED);
     SPI3CONSET = _SPI3CON_MSTEN_MASK | _SPI3CON_CKE_MASK;
+#ifdef WF_USE_DMA
+    SPI3CONSET = (1 << _SPI3CON_STXISEL_POSITION) | (1 << _SPI3CON_SRXISEL_POSITION); // TX empty, RX not empty
+#endif
     SPI3CONSET = _SPI3CON_ON_MASK; /* Enable SPI */
+    SPI3_DmaInit();
 
     IPC4bits.INT3IP = WD_INT_PRIO; // TODO PRIO
     WD_INT_CLEAR();
@@ -107,6 +260,11 @@ void WDRV_SPI_Init(void) {
 
 void WDRV_SPI_Deinit(void) {
     WD_INT_DISABLE();
+#ifdef WF_USE_DMA
+    mDMA1IntEnable(0);
+    DCH1CONCLR = _DCH1CON_CHEN_MASK;
+    DCH2CONCLR = _DCH2CON_CHEN_MASK;
+#endif
     SPI3CON = 0;
     SPI3CONSET = 0;
     WDRV_GPIO_PowerDown();
@@ -138,9 +296,11 @@ void WDRV_INTR_Deinit(void) {
 volatile bool g_interrupt_enabled = false;
 extern void WDRV_EXT_HWInterruptHandler(void const *pointer);
 void ISR_MRF24WN(void) {    
+    traceISR_ENTER(_EXTERNAL_3_VECTOR);
     WD_INT_DISABLE(); // disable further interrupts
     WD_INT_CLEAR();
     g_interrupt_enabled = true;
     WDRV_EXT_HWInterruptHandler(NULL);
     g_interrupt_enabled = false;
+    traceISR_EXIT(_EXTERNAL_3_VECTOR);
 }
\ No newline at end of file
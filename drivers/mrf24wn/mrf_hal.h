@@ -14,6 +14,9 @@ extern "C" {
     
 #define WF_SPI_SPEED                8000000UL  
 #define WD_INT_PRIO                 2
+#define WF_DMA_PRIO                 2       /* DMA1 block done, <= configMAX_SYSCALL_INTERRUPT_PRIORITY */
+#define WF_SPI_DMA_MIN              32      /* shorter transfers are polled, the task switch costs more */
+#define WF_SPI_DMA_MAX              1600    /* coherent bounce buffer, longer transfers go in chunks */
     
 #define WF_HIBERNATE_BIT            0
 #define WF_HIBERNATE_DIR            TRISA
@@ -52,6 +55,15 @@ void WDRV_HibernateEnable(void);
 void WDRV_HibernateDisable(void);
 bool WDRV_InHibernateMode(void);
 void WDRV_SPI_Out(uint8_t * const OutBuf, uint16_t OutSize);
+
+typedef struct {
+    uint32_t dma, dma_bytes;    /* transfers and bytes moved by DMA */
+    uint32_t polled, polled_bytes;
+    uint32_t timeouts;          /* DMA done never came, the rest of the chunk was polled ( in polled_bytes ) */
+    uint64_t wait_us;           /* wire time the CPU was free for other tasks */
+} mrf_spi_stat_t;
+
+void WDRV_SPI_Stat(mrf_spi_stat_t * stat);
     
 #ifdef	__cplusplus
 }
@@ -31,6 +31,7 @@ void WDRV_Assert(int condition, const char * msg, const char * file, int line) {
             LOG("\n[MRF] Driver ASSERTS: %s\n%s, line %u\n", msg, file, line);
         else
             LOG("\n[MRF] Driver ASSERTS:\n%s, line %u\n", file, line);
+        sys_log_flush();
         while(1);
     }
 }
@@ -4,28 +4,32 @@
  */
 
 #include "mrf_osal.h"
+#include "rtos_static.h"
+#include "sys_hrtimer.h"
+
+/* the driver task is the only one waiting on a semaphore, nsem.h instead of a kernel queue */
 
 OSAL_RESULT OSAL_SEM_Create(OSAL_SEM_HANDLE_TYPE* semID, OSAL_SEM_TYPE type, uint8_t maxCount, uint8_t initialCount) {
     switch (type) {
         case OSAL_SEM_TYPE_BINARY:
-            vSemaphoreCreateBinary(*(SemaphoreHandle_t*) semID);
+            *semID = rtos_nsem(1, 1); // vSemaphoreCreateBinary() starts given
             break;
         case OSAL_SEM_TYPE_COUNTING:
-            *(SemaphoreHandle_t*) semID = xSemaphoreCreateCounting((UBaseType_t) maxCount, (UBaseType_t) initialCount);
+            *semID = rtos_nsem(maxCount, initialCount);
             break;
         default:
-            *(SemaphoreHandle_t*) semID = NULL;
+            *semID = NULL;
             return OSAL_RESULT_NOT_IMPLEMENTED;
     }
-    if (*(SemaphoreHandle_t*) semID == NULL) {
+    if (*semID == NULL) {
         return OSAL_RESULT_FALSE;
     }
     return OSAL_RESULT_TRUE;
 }
 
 OSAL_RESULT OSAL_SEM_Delete(OSAL_SEM_HANDLE_TYPE* semID) {
-    vSemaphoreDelete(*(SemaphoreHandle_t*) semID);
-    *(SemaphoreHandle_t*) semID = NULL;
+    rtos_nsem_delete(*semID);
+    *semID = NULL;
     return OSAL_RESULT_TRUE;
 }
 
@@ -36,14 +40,14 @@ OSAL_RESULT OSAL_SEM_Pend(OSAL_SEM_HANDLE_TYPE* semID, uint16_t waitMS) {
     } else {
         timeout = (TickType_t) (waitMS / portTICK_PERIOD_MS);
     }
-    if (xSemaphoreTake(*(SemaphoreHandle_t*) semID, timeout) == pdTRUE)
+    if (nsem_take(*semID, timeout))
         return OSAL_RESULT_TRUE;
     else
         return OSAL_RESULT_FALSE;
 }
 
 OSAL_RESULT OSAL_SEM_Post(OSAL_SEM_HANDLE_TYPE* semID) {
-    if (xSemaphoreGive(*(SemaphoreHandle_t*) semID) == pdTRUE) {
+    if (nsem_give(*semID)) {
         return OSAL_RESULT_TRUE;
     }
     return OSAL_RESULT_FALSE;
@@ -51,7 +55,7 @@ OSAL_RESULT OSAL_SEM_Post(OSAL_SEM_HANDLE_TYPE* semID) {
 
 OSAL_RESULT OSAL_SEM_PostISR(OSAL_SEM_HANDLE_TYPE* semID) {
     BaseType_t _taskWoken = pdFALSE;
-    if (xSemaphoreGiveFromISR(*(SemaphoreHandle_t*) semID, &_taskWoken)) {
+    if (nsem_give_from_isr(*semID, &_taskWoken)) {
         portEND_SWITCHING_ISR(_taskWoken);
         return OSAL_RESULT_TRUE;
     }
@@ -63,7 +67,7 @@ OSAL_RESULT OSAL_MUTEX_Create(OSAL_MUTEX_HANDLE_TYPE* mutexID) {
     if (*(SemaphoreHandle_t*) mutexID != NULL) {
         return OSAL_RESULT_FALSE;
     }
-    *(SemaphoreHandle_t*) mutexID = xSemaphoreCreateMutex();
+    *(SemaphoreHandle_t*) mutexID = rtos_mutex();
     return OSAL_RESULT_TRUE;
 }
 
@@ -71,7 +75,7 @@ OSAL_RESULT OSAL_MUTEX_Delete(OSAL_MUTEX_HANDLE_TYPE* mutexID) {
     if (*(SemaphoreHandle_t*) mutexID == NULL) {
         return OSAL_RESULT_FALSE;
     }
-    vSemaphoreDelete(*(SemaphoreHandle_t*) mutexID);
+    rtos_delete(*(SemaphoreHandle_t*) mutexID);
     *(SemaphoreHandle_t*) mutexID = NULL;
     return OSAL_RESULT_TRUE;
 }
@@ -96,15 +100,43 @@ OSAL_RESULT OSAL_MUTEX_Unlock(OSAL_MUTEX_HANDLE_TYPE* mutexID) {
     return OSAL_RESULT_FALSE;
 }
 
+/* the handles live here, the mutex itself in the rtos_static pool */
+#define WDRV_MUTEX_MAX 8
+
+static OSAL_MUTEX_HANDLE_TYPE wdrv_mutex[WDRV_MUTEX_MAX];
+static uint32_t wdrv_mutex_map;
+
 uint32_t WDRV_MutexInit(OSAL_MUTEX_HANDLE_TYPE **mutex_ptr) {
-    *mutex_ptr = malloc(sizeof (OSAL_MUTEX_HANDLE_TYPE));
-    OSAL_MUTEX_Create(*mutex_ptr);
+    int i = -1;
+    taskENTER_CRITICAL();
+    if (~wdrv_mutex_map & ((1u << WDRV_MUTEX_MAX) - 1)) {
+        i = __builtin_ctz(~wdrv_mutex_map);
+        wdrv_mutex_map |= 1u << i;
+    }
+    taskEXIT_CRITICAL();
+    if (i < 0) {
+        *mutex_ptr = NULL;
+        LOG("[ERROR] WDRV_MutexInit: no handle\n");
+        return WDRV_OUT_OF_MEMORY;
+    }
+    *mutex_ptr = &wdrv_mutex[i]; // NULL, OSAL_MUTEX_Create() wants it so
+    if (OSAL_MUTEX_Create(*mutex_ptr) != OSAL_RESULT_TRUE || NULL == wdrv_mutex[i]) {
+        WDRV_MutexDestroy(mutex_ptr);
+        return WDRV_OUT_OF_MEMORY;
+    }
     return 0;
 }
 
 uint32_t WDRV_MutexDestroy(OSAL_MUTEX_HANDLE_TYPE **mutex_ptr) {
+    int i;
+    if (NULL == *mutex_ptr)
+        return 0;
     OSAL_MUTEX_Delete(*mutex_ptr);
-    free(*mutex_ptr);
+    i = *mutex_ptr - wdrv_mutex;
+    taskENTER_CRITICAL();
+    wdrv_mutex_map &= ~(1u << i);
+    taskEXIT_CRITICAL();
+    *mutex_ptr = NULL;
     return 0;
 }
 
@@ -160,7 +192,7 @@ WDRV_OSAL_STATUS WDRV_TaskCreate(void Task(void *), const char *task_name, int s
         unsigned long task_priority, TaskHandle_t *task_handle, bool auto_start) {
     WDRV_OSAL_STATUS ret = WDRV_SUCCESS;
     uint32_t os_ret;
-    os_ret = xTaskCreate((TaskFunction_t) Task, /* pointer to the task entry code */
+    os_ret = rtos_task_create((TaskFunction_t) Task, /* pointer to the task entry code */
             task_name, /* task name */
             stack_size, /* task stack size */
             param, /* parameters to pass */
@@ -179,9 +211,5 @@ WDRV_OSAL_STATUS WDRV_TaskDestroy(TaskHandle_t task_handle) {
 }
 
 void WDRV_UsecDelay(uint32_t uSec) {
-    unsigned long xUnblockPeriod = uSec / 1000;
-    if (!xUnblockPeriod) 
-        xUnblockPeriod = 1;
-    vTaskDelay(xUnblockPeriod * portTICK_PERIOD_MS);
-    return;
+    hrtimer_delay_us(uSec); // spins for the short SPI handshakes, sleeps for the long ones
 }
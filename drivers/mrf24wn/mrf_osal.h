@@ -17,8 +17,9 @@ extern "C" {
 #include "queue.h"
 #include "semphr.h"
 #include "task.h"
+#include "nsem.h"
 
-typedef SemaphoreHandle_t              OSAL_SEM_HANDLE_TYPE;
+typedef nsem_t *                       OSAL_SEM_HANDLE_TYPE; /* pointer size, the library keeps it */
 typedef SemaphoreHandle_t              OSAL_MUTEX_HANDLE_TYPE;
 typedef BaseType_t                     OSAL_CRITSECT_DATA_TYPE;
     
@@ -69,6 +70,16 @@ typedef enum {
     WDRV_OUT_OF_MEMORY        = 10,
 } WDRV_OSAL_STATUS;
 
+uint32_t WDRV_MutexInit(OSAL_MUTEX_HANDLE_TYPE **mutex_ptr);
+uint32_t WDRV_MutexDestroy(OSAL_MUTEX_HANDLE_TYPE **mutex_ptr);
+uint32_t WDRV_MutexLock(OSAL_MUTEX_HANDLE_TYPE *mutex_ptr, uint32_t tick_count);
+uint32_t WDRV_MutexUnlock(OSAL_MUTEX_HANDLE_TYPE *mutex_ptr);
+bool WDRV_SemInit(OSAL_SEM_HANDLE_TYPE *SemID);
+void WDRV_SemTake(OSAL_SEM_HANDLE_TYPE *SemID, uint16_t timeout);
+void WDRV_SemGive(OSAL_SEM_HANDLE_TYPE *SemID);
+void WDRV_SemGiveFromISR(OSAL_SEM_HANDLE_TYPE *SemID);
+void WDRV_SemDeInit(OSAL_SEM_HANDLE_TYPE *SemID);
+
 #ifdef	__cplusplus
 }
 #endif
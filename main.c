@@ -5,16 +5,27 @@
 
 #include "sys.h"
 #include "osal.h"
+#include "cpu_stats.h"
+#include "stack_mon.h"
 #include "lwip/tcpip.h"
 
 void ssl_test(void);
+void bench_run(void);
 void entryHTTP(void * arg);
 
 void entryMAIN(void * arg) {
     LOG("[MAIN] BEGIN\n");
+    rtos_static_dump();
+    uint32_t n = 0;
     while (1) {
         delay_ms(100);
         LED_GREEN_TOGGLE();
+        if (0 == ++n % 100) {
+            cpu_stats_dump(); // every 10 s
+            stack_mon_sample();
+        }
+        if (0 == n % 3000)
+            stack_mon_dump(); // every 5 min
     }
     (void) arg;
 }
@@ -27,9 +38,10 @@ int main(void) {
     //ssl_test();
     
     tcpip_init(0, 0);
+    //bench_run();
     WIFI_Start(NULL, NULL, NULL);     
-    xTaskCreate(entryHTTP, "HTTP", 1024, NULL, TASK_PRIORITY_NORMAL, NULL);
-    xTaskCreate(entryMAIN, "MAIN",  200, NULL, TASK_PRIORITY_NORMAL, NULL);    
+    rtos_task_create(entryHTTP, "HTTP", 1024, NULL, TASK_PRIORITY_NORMAL, NULL);
+    rtos_task_create(entryMAIN, "MAIN",  512, NULL, TASK_PRIORITY_NORMAL, NULL); // cpu_stats_dump and stack_mon_dump format on this stack
     
     //LOG("[RTOS] xPortGetFreeHeapSize:            %u\n", xPortGetFreeHeapSize());   
     vTaskStartScheduler();
@@ -552,6 +552,19 @@ extern "C" {
     #define traceFREE( pvAddress, uiSize )
 #endif
 
+#ifndef traceREALLOC
+    #define traceREALLOC( pvAddress, uiOldSize, uiNewSize )
+#endif
+
+#ifndef traceISR_ENTER
+    /* Called first and last in the C part of an interrupt handler. */
+    #define traceISR_ENTER( uxVector )
+#endif
+
+#ifndef traceISR_EXIT
+    #define traceISR_EXIT( uxVector )
+#endif
+
 #ifndef traceEVENT_GROUP_CREATE
 	#define traceEVENT_GROUP_CREATE( xEventGroup )
 #endif
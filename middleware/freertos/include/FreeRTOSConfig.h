@@ -27,8 +27,18 @@ typedef enum {
 #define configMINIMAL_STACK_SIZE                ( 200 )
 #define configISR_STACK_SIZE                    ( 400 )
 #define configSUPPORT_DYNAMIC_ALLOCATION        1
-#define configSUPPORT_STATIC_ALLOCATION         0
+#define configSUPPORT_STATIC_ALLOCATION         1
+/* Tasks, queues and semaphores of the middleware from static pools, see rtos_static.h */
+#define configUSE_STATIC_OBJECTS                1
+#if configUSE_STATIC_OBJECTS
+#define configTOTAL_HEAP_SIZE                   ( ( size_t ) 192 * 1024UL ) /* stacks moved out */
+#if !defined(__LANGUAGE_ASSEMBLY__)
+extern void rtos_task_cleanup( void * pxTCB );
+#endif
+#define portCLEAN_UP_TCB( pxTCB )               rtos_task_cleanup( pxTCB )
+#else
 #define configTOTAL_HEAP_SIZE                   ( ( size_t ) 256 * 1024UL )
+#endif
 #define configMAX_TASK_NAME_LEN                 ( 16 )
 #define configUSE_16_BIT_TICKS                  0
 #define configIDLE_SHOULD_YIELD                 1
@@ -42,18 +52,102 @@ typedef enum {
 #define configUSE_NEWLIB_REENTRANT              0
 //#define configENABLE_BACKWARD_COMPATIBILITY   0
 #define configUSE_TASK_FPU_SUPPORT              0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 2 /* mbedTLS arena tls_arena.h, lwIP netconn semaphore sys_arch.h */
 
 /* Hook function related definitions. */
 #define configUSE_IDLE_HOOK                     0
 #define configUSE_TICK_HOOK                     0
 #define configCHECK_FOR_STACK_OVERFLOW          2
+#define configRECORD_STACK_HIGH_ADDRESS         1 /* stack size of a task for stack_mon.c */
 #define configUSE_MALLOC_FAILED_HOOK            0
 
 /* Run time and task stats gathering related definitions. */
 #define configGENERATE_RUN_TIME_STATS           0
-#define configUSE_TRACE_FACILITY                0
+#define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Heap: 0 heap_4.c, 1 umm_malloc through heap_umm.c (umm_malloc_cfg.h)
+umm_malloc addresses at most 32767 blocks of 8 bytes, 8 bytes less than the 256 KB heap without
+configUSE_STATIC_OBJECTS, the rest of configTOTAL_HEAP_SIZE is not used */
+#define configUSE_UMM_MALLOC                    0
+
+/* Small objects from size-class free lists in front of the heap, see slab.h */
+#define configUSE_SLAB                          1
+
+/* Heap accounting per task and call site, see heap_trace.h */
+#define configUSE_HEAP_TRACE                    0
+#if configUSE_HEAP_TRACE && !defined(__LANGUAGE_ASSEMBLY__)
+#include <stddef.h>
+extern void heap_trace_malloc( void * pv, size_t xSize, void * pvCaller );
+extern void heap_trace_free( void * pv, size_t xSize );
+extern void heap_trace_realloc( void * pv, size_t xOldSize, size_t xNewSize, void * pvCaller );
+#define traceMALLOC( pvAddress, uiSize )                heap_trace_malloc( pvAddress, uiSize, __builtin_return_address( 0 ) )
+#define traceFREE( pvAddress, uiSize )                  heap_trace_free( pvAddress, uiSize )
+#define traceREALLOC( pvAddress, uiOldSize, uiNewSize ) heap_trace_realloc( pvAddress, uiOldSize, uiNewSize, __builtin_return_address( 0 ) )
+#endif
+
+/* Per task CPU time on the core timer, ISR time apart, see cpu_stats.h (needs configUSE_TRACE_FACILITY) */
+#define configUSE_CPU_STATS                     1
+
+/* Kernel event recorder in a RAM ring, see trace_rec.h and tools/trace2json.py */
+#define configUSE_TRACE_RECORDER                0
+
+/* Worst stack use of every task and a suggested size, see stack_mon.h */
+#define configUSE_STACK_MONITOR                 1
+
+#if !defined(__LANGUAGE_ASSEMBLY__)
+#if configUSE_CPU_STATS
+extern unsigned long cpu_stats_task_create( void );
+extern void cpu_stats_task_delete( unsigned long uxSlot );
+extern void cpu_stats_switch( unsigned long uxSlot );
+extern void cpu_stats_isr_enter( void );
+extern void cpu_stats_isr_exit( void );
+#define traceCPU_STATS( x )                             x
+#else
+#define traceCPU_STATS( x )
+#endif
+#if configUSE_TRACE_RECORDER
+extern void trace_rec_switch( unsigned long uxNumber );
+extern void trace_rec_task_create( unsigned long uxNumber, const char * pcName, unsigned long uxPriority );
+extern unsigned long trace_rec_queue_create( unsigned long uxType );
+extern void trace_rec_event( unsigned long uxEvent, unsigned long uxArg );
+#define traceRECORDER( x )                              x
+#define traceQUEUE_CREATE( pxNewQueue )                 ( pxNewQueue )->uxQueueNumber = trace_rec_queue_create( ( pxNewQueue )->ucQueueType )
+#define traceQUEUE_SEND( pxQueue )                      trace_rec_event( 'S', ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )             trace_rec_event( 's', ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE( pxQueue )                   trace_rec_event( 'R', ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )          trace_rec_event( 'r', ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )          trace_rec_event( 'w', ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )       trace_rec_event( 'W', ( pxQueue )->uxQueueNumber )
+#define traceTASK_NOTIFY()                              trace_rec_event( 'N', pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_FROM_ISR()                     trace_rec_event( 'N', pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR()                trace_rec_event( 'N', pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_TAKE_BLOCK()                   trace_rec_event( 'n', 0 )
+#define traceTASK_NOTIFY_WAIT_BLOCK()                   trace_rec_event( 'n', 0 )
+#else
+#define traceRECORDER( x )
+#endif
+#if configUSE_STACK_MONITOR
+extern void stack_mon_task_create( const char * pcName, unsigned long uxWords );
+extern void stack_mon_task_delete( void * xTask );
+#define traceSTACK_MON( x )                             x
+#else
+#define traceSTACK_MON( x )
+#endif
+#if configUSE_CPU_STATS || configUSE_TRACE_RECORDER || configUSE_STACK_MONITOR
+#define traceTASK_CREATE( pxNewTCB )                    do { traceCPU_STATS( ( pxNewTCB )->uxTaskNumber = cpu_stats_task_create() ); \
+                                                             traceRECORDER( trace_rec_task_create( ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName, ( pxNewTCB )->uxPriority ) ); \
+                                                             traceSTACK_MON( stack_mon_task_create( ( pxNewTCB )->pcTaskName, ( pxNewTCB )->pxEndOfStack - ( pxNewTCB )->pxStack + 1 ) ); } while( 0 )
+#define traceTASK_DELETE( pxTCB )                       do { traceCPU_STATS( cpu_stats_task_delete( ( pxTCB )->uxTaskNumber ) ); \
+                                                             traceRECORDER( trace_rec_event( 'D', ( pxTCB )->uxTCBNumber ) ); \
+                                                             traceSTACK_MON( stack_mon_task_delete( pxTCB ) ); } while( 0 )
+#define traceTASK_SWITCHED_IN()                         do { traceCPU_STATS( cpu_stats_switch( pxCurrentTCB->uxTaskNumber ) ); \
+                                                             traceRECORDER( trace_rec_switch( pxCurrentTCB->uxTCBNumber ) ); } while( 0 )
+#define traceISR_ENTER( uxVector )                      do { traceCPU_STATS( cpu_stats_isr_enter() ); traceRECORDER( trace_rec_event( 'I', uxVector ) ); } while( 0 )
+#define traceISR_EXIT( uxVector )                       do { traceRECORDER( trace_rec_event( 'i', uxVector ) ); traceCPU_STATS( cpu_stats_isr_exit() ); } while( 0 )
+#endif
+#endif
+
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES                   0
 #define configMAX_CO_ROUTINE_PRIORITIES         2
@@ -85,7 +179,7 @@ Only API functions that end in ...FromISR() can be used within interrupts. */
 #define INCLUDE_vTaskDelayUntil                 1
 #define INCLUDE_vTaskDelay                      1
 #define INCLUDE_xTaskGetSchedulerState          1
-#define INCLUDE_xTaskGetCurrentTaskHandle       0
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
 #define INCLUDE_uxTaskGetStackHighWaterMark     1
 #define INCLUDE_xTaskGetIdleTaskHandle          1
 #define INCLUDE_eTaskGetState                   0
@@ -303,6 +303,7 @@ void vPortIncrementTick( void )
 {
 UBaseType_t uxSavedStatus;
 
+	traceISR_ENTER( configTICK_INTERRUPT_VECTOR );
 	uxSavedStatus = uxPortSetInterruptMaskFromISR();
 	{
 		if( xTaskIncrementTick() != pdFALSE )
@@ -318,6 +319,7 @@ UBaseType_t uxSavedStatus;
 
 	/* Clear timer interrupt. */
 	configCLEAR_TICK_TIMER_INTERRUPT();
+	traceISR_EXIT( configTICK_INTERRUPT_VECTOR );
 }
 /*-----------------------------------------------------------*/
 
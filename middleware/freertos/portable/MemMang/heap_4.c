@@ -34,6 +34,7 @@
  * memory management pages of http://www.FreeRTOS.org for more information.
  */
 #include <stdlib.h>
+#include <string.h>
 
 /* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
 all the API functions to use the MPU wrappers.  That should only be done when
@@ -45,10 +46,17 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if( configUSE_SLAB == 1 )
+	#include "slab.h"
+#endif
+
 #if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
 	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+/* heap_umm.c provides the heap instead. */
+#if( configUSE_UMM_MALLOC == 0 )
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( xHeapStructSize << 1 ) )
 
@@ -89,6 +97,12 @@ static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert );
  */
 static void prvHeapInit( void );
 
+/*
+ * Adds the fixed overhead of a BlockLink_t structure to a requested size and
+ * rounds the result up to the heap byte alignment.
+ */
+static size_t prvWantedBlockSize( size_t xWantedSize );
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -116,6 +130,31 @@ void *pvPortMalloc( size_t xWantedSize )
 BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
 
+	#if( configUSE_SLAB == 1 )
+	{
+		/* Small requests are served by the slab front end, heap_4 is only
+		used when the size class is exhausted.  The trace hooks run with the
+		scheduler suspended, as on the heap_4 path. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= SLAB_MAX_SIZE ) )
+		{
+			vTaskSuspendAll();
+			{
+				pvReturn = slab_malloc( xWantedSize );
+				if( pvReturn != NULL )
+				{
+					traceMALLOC( pvReturn, slab_size( pvReturn ) );
+				}
+			}
+			( void ) xTaskResumeAll();
+
+			if( pvReturn != NULL )
+			{
+				return pvReturn;
+			}
+		}
+	}
+	#endif
+
 	vTaskSuspendAll();
 	{
 		/* If this is the first call to malloc then the heap will require
@@ -135,29 +174,7 @@ void *pvReturn = NULL;
 		kernel, so it must be free. */
 		if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
 		{
-			/* The wanted size is increased so it can contain a BlockLink_t
-			structure in addition to the requested amount of bytes. */
-			if( xWantedSize > 0 )
-			{
-				xWantedSize += xHeapStructSize;
-
-				/* Ensure that blocks are always aligned to the required number
-				of bytes. */
-				if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
-				{
-					/* Byte alignment required. */
-					xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
-configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			xWantedSize = prvWantedBlockSize( xWantedSize );
 
 			if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
 			{
@@ -266,6 +283,21 @@ void vPortFree( void *pv )
 uint8_t *puc = ( uint8_t * ) pv;
 BlockLink_t *pxLink;
 
+	#if( configUSE_SLAB == 1 )
+	{
+		if( slab_size( pv ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				traceFREE( pv, slab_size( pv ) );
+				slab_free( pv );
+			}
+			( void ) xTaskResumeAll();
+			return;
+		}
+	}
+	#endif
+
 	if( pv != NULL )
 	{
 		/* The memory being freed will have an BlockLink_t structure immediately
@@ -309,6 +341,166 @@ BlockLink_t *pxLink;
 }
 /*-----------------------------------------------------------*/
 
+void *pvPortRealloc( void *pv, size_t xWantedSize )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink, *pxBlock, *pxPreviousBlock, *pxNextBlock, *pxNewBlockLink;
+size_t xBlockSize, xNewSize;
+void *pvReturn = NULL;
+
+	if( pv == NULL )
+	{
+		return pvPortMalloc( xWantedSize );
+	}
+
+	if( xWantedSize == 0 )
+	{
+		vPortFree( pv );
+		return NULL;
+	}
+
+	#if( configUSE_SLAB == 1 )
+	{
+		/* A slab object can only shrink within its size class, anything
+		bigger is moved. */
+		xBlockSize = slab_size( pv );
+		if( xBlockSize != 0 )
+		{
+			if( xWantedSize <= xBlockSize )
+			{
+				vTaskSuspendAll();
+				{
+					traceREALLOC( pv, xBlockSize, xBlockSize );
+				}
+				( void ) xTaskResumeAll();
+				return pv;
+			}
+
+			pvReturn = pvPortMalloc( xWantedSize );
+			if( pvReturn != NULL )
+			{
+				memcpy( pvReturn, pv, xBlockSize );
+				vPortFree( pv );
+			}
+			return pvReturn;
+		}
+	}
+	#endif
+
+	/* Same size computation as pvPortMalloc(), the size includes the
+	BlockLink_t structure. */
+	xNewSize = prvWantedBlockSize( xWantedSize );
+	if( ( xNewSize == 0 ) || ( ( xNewSize & xBlockAllocatedBit ) != 0 ) )
+	{
+		return NULL;
+	}
+
+	puc -= xHeapStructSize;
+	pxLink = ( void * ) puc;
+
+	/* Check the block is actually allocated. */
+	configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+	configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+	vTaskSuspendAll();
+	{
+		xBlockSize = pxLink->xBlockSize & ~xBlockAllocatedBit;
+
+		if( xNewSize > xBlockSize )
+		{
+			/* Growing - the block can only be extended in place if the block
+			that immediately follows it is free and big enough.  The free list
+			is ordered by address so stop at the first block that is not below
+			the end of this one. */
+			pxNextBlock = ( void * ) ( puc + xBlockSize );
+			pxPreviousBlock = &xStart;
+			pxBlock = xStart.pxNextFreeBlock;
+			while( pxBlock < pxNextBlock )
+			{
+				pxPreviousBlock = pxBlock;
+				pxBlock = pxBlock->pxNextFreeBlock;
+			}
+
+			if( ( pxBlock == pxNextBlock ) && ( pxBlock != pxEnd ) && ( ( xBlockSize + pxBlock->xBlockSize ) >= xNewSize ) )
+			{
+				/* Take the neighbour out of the list of free blocks and
+				absorb it. */
+				pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+				xFreeBytesRemaining -= pxBlock->xBlockSize;
+				xBlockSize += pxBlock->xBlockSize;
+				pvReturn = pv;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* Shrinking, or the size did not change after alignment. */
+			pvReturn = pv;
+		}
+
+		if( pvReturn != NULL )
+		{
+			/* Give back whatever is left over past the new size, the same way
+			pvPortMalloc() splits a block that is larger than required. */
+			if( ( xBlockSize - xNewSize ) > heapMINIMUM_BLOCK_SIZE )
+			{
+				pxNewBlockLink = ( void * ) ( puc + xNewSize );
+				configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+				pxNewBlockLink->xBlockSize = xBlockSize - xNewSize;
+				xBlockSize = xNewSize;
+
+				xFreeBytesRemaining += pxNewBlockLink->xBlockSize;
+				prvInsertBlockIntoFreeList( pxNewBlockLink );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+			{
+				xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			traceREALLOC( pv, pxLink->xBlockSize & ~xBlockAllocatedBit, xBlockSize );
+			pxLink->xBlockSize = xBlockSize | xBlockAllocatedBit;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( pvReturn == NULL )
+	{
+		/* Could not be resized in place - move it.  Only the bytes that are
+		valid in both blocks are copied. */
+		pvReturn = pvPortMalloc( xWantedSize );
+		if( pvReturn != NULL )
+		{
+			xBlockSize -= xHeapStructSize;
+			memcpy( pvReturn, pv, ( xBlockSize < xWantedSize ) ? xBlockSize : xWantedSize );
+			vPortFree( pv );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
 size_t xPortGetFreeHeapSize( void )
 {
 	return xFreeBytesRemaining;
@@ -321,12 +513,66 @@ size_t xPortGetMinimumEverFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+size_t xPortGetLargestFreeBlockSize( void )
+{
+BlockLink_t *pxBlock;
+size_t xLargest = 0;
+
+	vTaskSuspendAll();
+	{
+		if( pxEnd != NULL )
+		{
+			for( pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				if( pxBlock->xBlockSize > xLargest )
+				{
+					xLargest = pxBlock->xBlockSize;
+				}
+			}
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return xLargest;
+}
+/*-----------------------------------------------------------*/
+
 void vPortInitialiseBlocks( void )
 {
 	/* This just exists to keep the linker quiet. */
 }
 /*-----------------------------------------------------------*/
 
+static size_t prvWantedBlockSize( size_t xWantedSize )
+{
+	/* The wanted size is increased so it can contain a BlockLink_t
+	structure in addition to the requested amount of bytes. */
+	if( xWantedSize > 0 )
+	{
+		xWantedSize += xHeapStructSize;
+
+		/* Ensure that blocks are always aligned to the required number
+		of bytes. */
+		if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+		{
+			/* Byte alignment required. */
+			xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+			configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xWantedSize;
+}
+/*-----------------------------------------------------------*/
+
 static void prvHeapInit( void )
 {
 BlockLink_t *pxFirstFreeBlock;
@@ -435,3 +681,4 @@ uint8_t *puc;
 	}
 }
 
+#endif /* configUSE_UMM_MALLOC */
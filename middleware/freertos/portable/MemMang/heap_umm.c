@@ -0,0 +1,197 @@
+/*
+ * pvPortMalloc() and vPortFree() on top of umm_malloc, selected with
+ * configUSE_UMM_MALLOC in FreeRTOSConfig.h instead of heap_4.c.
+ *
+ * umm_malloc hands out 8 byte blocks from a best fit (or first fit, see
+ * umm_malloc_cfg.h) free list and keeps the allocation header to 4 bytes.
+ * The free size statistics are in bytes so the xPortGet...() functions
+ * report the same way as the ones in heap_4.c.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configUSE_UMM_MALLOC == 1 )
+
+#include "umm_malloc.h"
+
+#if( configUSE_SLAB == 1 )
+	#include "slab.h"
+#endif
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+void *pvReturn;
+
+	#if( configUSE_SLAB == 1 )
+	{
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= SLAB_MAX_SIZE ) )
+		{
+			vTaskSuspendAll();
+			{
+				pvReturn = slab_malloc( xWantedSize );
+				if( pvReturn != NULL )
+				{
+					traceMALLOC( pvReturn, slab_size( pvReturn ) );
+				}
+			}
+			( void ) xTaskResumeAll();
+
+			if( pvReturn != NULL )
+			{
+				return pvReturn;
+			}
+		}
+	}
+	#endif
+
+	/* The trace hooks run with the scheduler suspended, the umm lock nests. */
+	vTaskSuspendAll();
+	{
+		pvReturn = umm_malloc( xWantedSize );
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+	#if( configUSE_SLAB == 1 )
+	{
+		if( slab_size( pv ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				traceFREE( pv, slab_size( pv ) );
+				slab_free( pv );
+			}
+			( void ) xTaskResumeAll();
+			return;
+		}
+	}
+	#endif
+
+	if( pv != NULL )
+	{
+		vTaskSuspendAll();
+		{
+			traceFREE( pv, 0 );
+			umm_free( pv );
+		}
+		( void ) xTaskResumeAll();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortRealloc( void *pv, size_t xWantedSize )
+{
+void *pvReturn;
+
+	#if( configUSE_SLAB == 1 )
+	{
+		size_t xSlabSize = slab_size( pv );
+
+		if( ( xSlabSize != 0 ) && ( xWantedSize != 0 ) )
+		{
+			if( xWantedSize <= xSlabSize )
+			{
+				vTaskSuspendAll();
+				{
+					traceREALLOC( pv, xSlabSize, xSlabSize );
+				}
+				( void ) xTaskResumeAll();
+				return pv;
+			}
+
+			pvReturn = pvPortMalloc( xWantedSize );
+			if( pvReturn != NULL )
+			{
+				memcpy( pvReturn, pv, xSlabSize );
+				vPortFree( pv );
+			}
+			return pvReturn;
+		}
+		else if( xSlabSize != 0 )
+		{
+			vPortFree( pv );
+			return NULL;
+		}
+	}
+	#endif
+
+	/* umm_realloc() copies only the old payload and resizes in place when the
+	neighbours allow it. */
+	vTaskSuspendAll();
+	{
+		pvReturn = umm_realloc( pv, xWantedSize );
+		if( ( pv != NULL ) && ( pvReturn != pv ) && ( ( pvReturn != NULL ) || ( xWantedSize == 0 ) ) )
+		{
+			traceFREE( pv, 0 );
+		}
+		if( ( pvReturn != NULL ) && ( pvReturn != pv ) )
+		{
+			traceMALLOC( pvReturn, xWantedSize );
+		}
+		else if( pvReturn != NULL )
+		{
+			traceREALLOC( pv, 0, xWantedSize );
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return umm_free_heap_size();
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return umm_min_free_heap_size();
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetLargestFreeBlockSize( void )
+{
+	return umm_max_free_block_size();
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortWantedSizeAlign( size_t xSize )
+{
+	return ( xSize + 3 ) & ~( ( size_t ) 3 );
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+
+#endif /* configUSE_UMM_MALLOC */
@@ -543,8 +543,13 @@ UMM_H_ATTPACKPRE typedef struct umm_block_t {
 #  define umm_realloc realloc
 #endif
 
+// The top bit of a block number is the free list flag, a larger heap is cut
+// to UMM_BLOCKNO_MASK blocks
+#define UMM_HEAP_BLOCKS ((UMM_MALLOC_CFG__HEAP_SIZE / sizeof(umm_block)) < UMM_BLOCKNO_MASK ? \
+                         (UMM_MALLOC_CFG__HEAP_SIZE / sizeof(umm_block)) : UMM_BLOCKNO_MASK)
+
 umm_block 
-umm_heap[(UMM_MALLOC_CFG__HEAP_SIZE / sizeof(umm_block))] 
+umm_heap[UMM_HEAP_BLOCKS] 
 __attribute__((aligned(8))) = {0};
 
 const unsigned short int umm_numblocks = (sizeof(umm_heap) / sizeof(umm_block));
@@ -590,6 +595,8 @@ UMM_HEAP_INFO heapInfo;
 void *umm_info( void *ptr, int force ) {
 
    unsigned short int blockNo = 0;
+   unsigned short int blockSize;
+   void *found = NULL;
 
    // Protect the critical section...
    //
@@ -600,97 +607,93 @@ void *umm_info( void *ptr, int force ) {
    //
    memset( &heapInfo, 0, sizeof( heapInfo ) );
 
-   DBG_LOG_FORCE( force, "\n\nDumping the umm_heap...\n" );
-
-   DBG_LOG_FORCE( force, "|0x%08x|B %5i|NB %5i|PB %5i|Z %5i|NF %5i|PF %5i|\n",
-         (unsigned int)(&UMM_BLOCK(blockNo)),
-         blockNo,
-         UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK,
-         UMM_PBLOCK(blockNo),
-         (UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK )-blockNo,
-         UMM_NFREE(blockNo),
-         UMM_PFREE(blockNo) );
-
-   // Now loop through the block lists, and keep track of the number and size
-   // of used and free blocks. The terminating condition is an nb pointer with
-   // a value of zero...
-
-   blockNo = UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK;
+   // Walk the heap from block 0 until the last block, which points to 0.
+   // The high bit of the next block index tells if the block is free.
 
    while( UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK ) {
-      ++heapInfo.totalEntries;
-      heapInfo.totalBlocks += (UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK )-blockNo;
+      blockSize = (UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK) - blockNo;
 
-      // Is this a free block?
+      ++heapInfo.totalEntries;
+      heapInfo.totalBlocks += blockSize;
 
       if( UMM_NBLOCK(blockNo) & UMM_FREELIST_MASK ) {
          ++heapInfo.freeEntries;
-         heapInfo.freeBlocks += (UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK )-blockNo;
-
-         DBG_LOG_FORCE( force, "|0x%08x|B %5i|NB %5i|PB %5i|Z %5i|NF %5i|PF %5i|\n",
-               (unsigned int)(&UMM_BLOCK(blockNo)),
-               blockNo,
-               UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK,
-               UMM_PBLOCK(blockNo),
-               (UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK )-blockNo,
-               UMM_NFREE(blockNo),
-               UMM_PFREE(blockNo) );
-
-         // Does this block address match the ptr we may be trying to free?
-
-         if( ptr == &UMM_BLOCK(blockNo) ) {
+         heapInfo.freeBlocks += blockSize;
 
-            // Release the critical section...
-            //
-            UMM_CRITICAL_EXIT();
-
-            return( ptr );
+         if( ptr == &UMM_DATA(blockNo) ) {
+            found = ptr;
          }
       } else {
          ++heapInfo.usedEntries;
-         heapInfo.usedBlocks += (UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK )-blockNo;
-
-         DBG_LOG_FORCE( force, "|0x%08x|B %5i|NB %5i|PB %5i|Z %5i|\n",
-               (unsigned int)(&UMM_BLOCK(blockNo)),
-               blockNo,
-               UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK,
-               UMM_PBLOCK(blockNo),
-               (UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK )-blockNo );
+         heapInfo.usedBlocks += blockSize;
       }
 
+      DBG_LOG_FORCE( force, "|0x%08lx|B %5i|NB %5i|PB %5i|Z %5i|%s\n",
+            (unsigned long)(&UMM_BLOCK(blockNo)), blockNo,
+            UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK, UMM_PBLOCK(blockNo),
+            blockSize, (UMM_NBLOCK(blockNo) & UMM_FREELIST_MASK) ? "FREE" : "" );
+
       blockNo = UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK;
    }
 
-   // Update the accounting totals with information from the last block, the
-   // rest must be free!
+   UMM_CRITICAL_EXIT();
 
-   heapInfo.freeBlocks  += UMM_NUMBLOCKS-blockNo;
-   heapInfo.totalBlocks += UMM_NUMBLOCKS-blockNo;
+   return( found );
+}
 
-   DBG_LOG_FORCE( force, "|0x%08x|B %5i|NB %5i|PB %5i|Z %5i|NF %5i|PF %5i|\n",
-         (unsigned int)(&UMM_BLOCK(blockNo)),
-         blockNo,
-         UMM_NBLOCK(blockNo) & UMM_BLOCKNO_MASK,
-         UMM_PBLOCK(blockNo),
-         UMM_NUMBLOCKS-blockNo,
-         UMM_NFREE(blockNo),
-         UMM_PFREE(blockNo) );
+// ----------------------------------------------------------------------------
+// Used blocks are counted as they are handed out and returned, which makes
+// the free size O(1). Block 0 (free list head), block 1 and the end block
+// are never available.
 
-   DBG_LOG_FORCE( force, "Total Entries %5i    Used Entries %5i    Free Entries %5i\n",
-         heapInfo.totalEntries,
-         heapInfo.usedEntries,
-         heapInfo.freeEntries );
+#ifdef UMM_LOCK_IRQ
+unsigned int umm_irq_off_max = 0;
+#endif
 
-   DBG_LOG_FORCE( force, "Total Blocks  %5i    Used Blocks  %5i    Free Blocks  %5i\n",
-         heapInfo.totalBlocks,
-         heapInfo.usedBlocks,
-         heapInfo.freeBlocks  );
+static unsigned short int umm_used_blocks = 0;
+static unsigned short int umm_max_used_blocks = 0;
+
+#define UMM_AVAILABLE_BLOCKS  (UMM_NUMBLOCKS - 3)
+
+static void umm_account( int blocks ) {
+   umm_used_blocks += blocks;
+
+   if( umm_used_blocks > umm_max_used_blocks )
+      umm_max_used_blocks = umm_used_blocks;
+}
+
+size_t umm_free_heap_size( void ) {
+   return( (size_t)(UMM_AVAILABLE_BLOCKS - umm_used_blocks) * sizeof(umm_block) );
+}
+
+size_t umm_min_free_heap_size( void ) {
+   return( (size_t)(UMM_AVAILABLE_BLOCKS - umm_max_used_blocks) * sizeof(umm_block) );
+}
+
+size_t umm_max_free_block_size( void ) {
+   unsigned short int cf, blockSize, maxSize = 0;
+
+   UMM_CRITICAL_ENTRY();
+
+   // The free list ends at the block that points past the heap, the space
+   // after it is free too
+
+   for( cf = UMM_NFREE(0); cf; cf = UMM_NFREE(cf) ) {
+      if( UMM_NBLOCK(cf) & UMM_BLOCKNO_MASK )
+         blockSize = (UMM_NBLOCK(cf) & UMM_BLOCKNO_MASK) - cf;
+      else
+         blockSize = UMM_AVAILABLE_BLOCKS + 1 - cf;
+
+      if( blockSize > maxSize )
+         maxSize = blockSize;
+   }
+
+   if( 0 == UMM_NFREE(0) && 0 == UMM_NBLOCK(0) )
+      maxSize = UMM_AVAILABLE_BLOCKS;   // not initialized yet
 
-   // Release the critical section...
-   //
    UMM_CRITICAL_EXIT();
 
-   return( NULL );
+   return( (size_t)maxSize * sizeof(umm_block) );
 }
 
 // ----------------------------------------------------------------------------
@@ -803,6 +806,8 @@ void umm_free( void *ptr ) {
 
    DBG_LOG_DEBUG( "Freeing block %6i\n", c );
 
+   umm_account( -(int)((UMM_NBLOCK(c) & UMM_BLOCKNO_MASK) - c) );
+
    // Now let's assimilate this block with the next one if possible.
 
    umm_assimilate_up( c );
@@ -978,6 +983,8 @@ void *umm_malloc( size_t size ) {
       UMM_PBLOCK(cf+blocks)    = cf;
    }
 
+   umm_account( blocks );
+
    // Release the critical section...
    //
    UMM_CRITICAL_EXIT();
@@ -991,6 +998,7 @@ void *umm_realloc( void *ptr, size_t size ) {
 
    unsigned short int blocks;
    unsigned short int blockSize;
+   unsigned short int curBlocks;
 
    unsigned short int c;
 
@@ -1101,8 +1109,11 @@ void *umm_realloc( void *ptr, size_t size ) {
    }
 
    // Now calculate the block size again...and we'll have three cases
+   // The blocks taken over from free neighbours are in use now
 
+   curBlocks = blockSize;
    blockSize = (UMM_NBLOCK(c) - c);
+   umm_account( blockSize - curBlocks );
 
    if( blockSize == blocks ) {
       // This space intentionally left blank - return the original pointer!
@@ -1126,13 +1137,13 @@ void *umm_realloc( void *ptr, size_t size ) {
       DBG_LOG_DEBUG( "realloc %i to a bigger block %i, make new, copy, and free the old\n", blockSize, blocks );
 
       // Now umm_malloc() a new/ one, copy the old data to the new block, and
-      // free up the old block, but only if the malloc was sucessful!
+      // free up the old block, but only if the malloc was sucessful! If it
+      // was not, the old block stays valid as realloc() requires.
 
       if( (ptr = umm_malloc( size )) ) {
          memcpy( ptr, oldptr, curSize );
+         umm_free( oldptr );
       }
-
-      umm_free( oldptr );
    }
 
    // Release the critical section...
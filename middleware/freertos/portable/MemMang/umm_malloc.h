@@ -35,6 +35,10 @@ void *umm_malloc( size_t size );
 void *umm_realloc( void *ptr, size_t size );
 void umm_free( void *ptr );
 
+size_t umm_free_heap_size( void );
+size_t umm_min_free_heap_size( void );
+size_t umm_max_free_block_size( void );
+
 
 // ----------------------------------------------------------------------------
 
@@ -62,10 +62,23 @@
 
 
 // ----------------------------------------------------------------------------
-// Size of the heap in bytes
-#include "FreeRTOSConfig.h"
+// Size of the heap in bytes, umm_malloc is the heap when configUSE_UMM_MALLOC
+// is set (heap_umm.c), heap_4.c otherwise
+#include "FreeRTOS.h"
+#include "task.h"
 #define UMM_MALLOC_CFG__HEAP_SIZE (configTOTAL_HEAP_SIZE)
 
+// Block numbers are 15 bits: at most 32767 blocks of 8 bytes (262136 bytes),
+// umm_malloc.c uses that much of a larger configTOTAL_HEAP_SIZE
+
+#if( configUSE_UMM_MALLOC == 0 )
+#define UMM_MALLOC_CFG__DONT_BUILD
+#endif
+
+// Free list search, best fit keeps fragmentation lower, first fit is faster
+#define UMM_BEST_FIT
+//#define UMM_FIRST_FIT
+
 // ----------------------------------------------------------------------------
 // A couple of macros to make packing structures less compiler dependent
 
@@ -81,8 +94,24 @@
 // NOTE WELL that these macros MUST be allowed to nest, because umm_free() is
 // called from within umm_malloc()
 
-#define UMM_CRITICAL_ENTRY()    int isrUmm = __builtin_disable_interrupts()
-#define UMM_CRITICAL_EXIT()     if(isrUmm) __builtin_mtc0(12,0,(__builtin_mfc0(12,0) | 0x0001))
+//
+// By default only task switching is stopped, the same as heap_4.c, so the
+// free list search does not add to the interrupt latency. UMM_LOCK_IRQ
+// brings back the old interrupt disabling and measures the longest time
+// interrupts stayed off in umm_irq_off_max (core timer ticks).
+
+//#define UMM_LOCK_IRQ
+
+#ifdef UMM_LOCK_IRQ
+extern unsigned int umm_irq_off_max;
+#define UMM_CRITICAL_ENTRY()    int isrUmm = __builtin_disable_interrupts(); unsigned int ummStart = _CP0_GET_COUNT()
+#define UMM_CRITICAL_EXIT()     do { unsigned int ummTicks = _CP0_GET_COUNT() - ummStart; \
+                                    if( ummTicks > umm_irq_off_max ) umm_irq_off_max = ummTicks; \
+                                    if(isrUmm) __builtin_mtc0(12,0,(__builtin_mfc0(12,0) | 0x0001)); } while(0)
+#else
+#define UMM_CRITICAL_ENTRY()    vTaskSuspendAll()
+#define UMM_CRITICAL_EXIT()     ( void ) xTaskResumeAll()
+#endif
 
 
 
@@ -29,11 +29,14 @@
 
 #define HTTPCLIENT_DEBUG 0
 
+#include "heap_trace.h"
+#include "trace_rec.h"
+
 #if HTTPCLIENT_DEBUG
 #include "sys.h"
 #define ERR(fmt,arg...)   LOG("[HTTP-E]: "fmt"\n",##arg)
 #define WRN(fmt,arg...)   LOG("[HTTP-W]: "fmt"\n",##arg)
-#define DBG(fmt,arg...)   LOG("[HTTP-D]: "fmt"\n",##arg)
+#define DBG(fmt,arg...)   LOG_BIN("[HTTP-D]: "fmt"\n",##arg)
 #else
 #define DBG(x, ...)
 #define WRN(x, ...)
@@ -1017,6 +1020,7 @@ static int httpclient_ssl_conn(httpclient_t *client, char *host) {
     const char *pers = "https";
     int value, ret = 0;
     uint32_t flags;
+    TickType_t start;
     char port[10] = {0};
     httpclient_ssl_t *ssl;
 
@@ -1027,6 +1031,9 @@ static int httpclient_ssl_conn(httpclient_t *client, char *host) {
         goto exit;
     }
     ssl = (httpclient_ssl_t *) client->ssl;
+#ifdef MBEDTLS_PIC32_ARENA
+    ssl->arena = tls_arena_create(MBEDTLS_PIC32_ARENA); // NULL: mbedtls uses the heap
+#endif
 
     if (client->server_cert)
         authmode = MBEDTLS_SSL_VERIFY_REQUIRED;
@@ -1132,13 +1139,27 @@ static int httpclient_ssl_conn(httpclient_t *client, char *host) {
     /*
      * Handshake
      */
+    heap_trace_begin();
+    TRACE_REC_BEGIN(TRACE_REC_ID_HANDSHAKE);
+    start = xTaskGetTickCount();
     while ((ret = mbedtls_ssl_handshake(&ssl->ssl_ctx)) != 0) {
         if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            heap_trace_end();
+            TRACE_REC_END(TRACE_REC_ID_HANDSHAKE);
             DBG("mbedtls_ssl_handshake() failed, ret:-0x%x.", -ret);
+            trace_rec_dump();
+            trace_rec_start();
             ret = -1;
             goto exit;
         }
     }
+    value = heap_trace_end();
+    TRACE_REC_END(TRACE_REC_ID_HANDSHAKE);
+    DBG("mbedtls_ssl_handshake() heap peak: %d", value);
+    if ((xTaskGetTickCount() - start) * portTICK_PERIOD_MS > TRACE_REC_STALL_MS) {
+        trace_rec_dump(); // slow handshake, keep what led to it
+        trace_rec_start();
+    }
 
     /*
      * Verify the server certificate
@@ -1177,6 +1198,10 @@ static int httpclient_ssl_close(httpclient_t *client) {
     mbedtls_ssl_config_free(&ssl->ssl_conf);
     mbedtls_ctr_drbg_free(&ssl->ctr_drbg);
     mbedtls_entropy_free(&ssl->entropy);
+#ifdef MBEDTLS_PIC32_ARENA
+    tls_arena_dump(ssl->arena);
+    tls_arena_destroy(ssl->arena);
+#endif
 
     free(ssl);
     return 0;
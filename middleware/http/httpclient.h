@@ -331,6 +331,9 @@ typedef struct {
     mbedtls_x509_crt cacert;
     mbedtls_x509_crt clicert;
     mbedtls_pk_context pkey;
+#ifdef MBEDTLS_PIC32_ARENA
+    tls_arena_t * arena;                /* everything mbedtls allocates for this connection */
+#endif
 } httpclient_ssl_t;
 #endif
 
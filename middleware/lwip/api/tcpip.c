@@ -59,13 +59,21 @@
 static tcpip_init_done_fn tcpip_init_done;
 static void *tcpip_init_done_arg;
 static sys_mbox_t mbox;
+#if TCPIP_MBOX_SPLIT
+/* [WizIO] received packets wait here, mbox keeps the API calls, callbacks and timeouts */
+static sys_mbox_t mbox_in;
+struct tcpip_mbox_stats tcpip_mbox_stats;
+#endif /* TCPIP_MBOX_SPLIT */
 
 #if LWIP_TCPIP_CORE_LOCKING
 /** The global semaphore to lock the stack. */
 sys_mutex_t lock_tcpip_core;
 #endif /* LWIP_TCPIP_CORE_LOCKING */
 
-#if LWIP_TIMERS
+#if TCPIP_MBOX_SPLIT
+/* wait for a message of either mailbox, timeouts are processed while waiting */
+#define TCPIP_MBOX_FETCH(mbox, msg) tcpip_mbox_fetch(msg)
+#elif LWIP_TIMERS
 /* wait for a message, timeouts are processed while waiting */
 #define TCPIP_MBOX_FETCH(mbox, msg) sys_timeouts_mbox_fetch(mbox, msg)
 #else /* LWIP_TIMERS */
@@ -73,6 +81,65 @@ sys_mutex_t lock_tcpip_core;
 #define TCPIP_MBOX_FETCH(mbox, msg) sys_mbox_fetch(mbox, msg)
 #endif /* LWIP_TIMERS */
 
+#if TCPIP_MBOX_SPLIT
+/* [WizIO] weighted round robin: up to TCPIP_API_BURST API messages, then up to
+ * TCPIP_INPUT_BURST received packets, an API call never waits behind more than
+ * TCPIP_INPUT_BURST packets however deep the input mailbox is */
+static u8_t tcpip_turn_input;
+static u8_t tcpip_served;
+
+static void *
+tcpip_mbox_pick(void)
+{
+  void *msg;
+  int i;
+  for (i = 0; i < 3; i++) {
+    if (tcpip_turn_input) {
+      if (tcpip_served < TCPIP_INPUT_BURST && sys_arch_mbox_tryfetch(&mbox_in, &msg) == ERR_OK) {
+        tcpip_served++;
+        tcpip_mbox_stats.in_done++;
+        return msg;
+      }
+    } else {
+      if (tcpip_served < TCPIP_API_BURST && sys_arch_mbox_tryfetch(&mbox, &msg) == ERR_OK) {
+        tcpip_served++;
+        tcpip_mbox_stats.api_done++;
+        return msg;
+      }
+    }
+    tcpip_turn_input = !tcpip_turn_input;
+    tcpip_served = 0;
+  }
+  return NULL;
+}
+
+static void
+tcpip_mbox_fetch(void **msg)
+{
+#if LWIP_TIMERS
+  u32_t sleeptime;
+  for (;;) {
+    /* timeouts due run first, as with sys_timeouts_mbox_fetch() */
+    sleeptime = sys_timeouts_sleeptime();
+    if (sleeptime == 0) {
+      sys_check_timeouts();
+      continue;
+    }
+    if ((*msg = tcpip_mbox_pick()) != NULL) {
+      return;
+    }
+    if (sys_arch_mbox_wait2(&mbox, &mbox_in, (sleeptime == 0xffffffff) ? 0 : sleeptime) == SYS_ARCH_TIMEOUT) {
+      sys_check_timeouts();
+    }
+  }
+#else /* LWIP_TIMERS */
+  while ((*msg = tcpip_mbox_pick()) == NULL) {
+    sys_arch_mbox_wait2(&mbox, &mbox_in, 0);
+  }
+#endif /* LWIP_TIMERS */
+}
+#endif /* TCPIP_MBOX_SPLIT */
+
 /**
  * The main lwIP thread. This thread has exclusive access to lwIP core functions
  * (unless access to them is not locked). Other threads communicate with this
@@ -182,6 +249,9 @@ tcpip_inpkt(struct pbuf *p, struct netif *inp, netif_input_fn input_fn)
 
   msg = (struct tcpip_msg *)memp_malloc(MEMP_TCPIP_MSG_INPKT);
   if (msg == NULL) {
+#if TCPIP_MBOX_SPLIT
+    tcpip_mbox_stats.in_drop++;
+#endif /* TCPIP_MBOX_SPLIT */
     return ERR_MEM;
   }
 
@@ -189,7 +259,12 @@ tcpip_inpkt(struct pbuf *p, struct netif *inp, netif_input_fn input_fn)
   msg->msg.inp.p = p;
   msg->msg.inp.netif = inp;
   msg->msg.inp.input_fn = input_fn;
+#if TCPIP_MBOX_SPLIT
+  if (sys_mbox_trypost(&mbox_in, msg) != ERR_OK) {
+    tcpip_mbox_stats.in_drop++;
+#else /* TCPIP_MBOX_SPLIT */
   if (sys_mbox_trypost(&mbox, msg) != ERR_OK) {
+#endif /* TCPIP_MBOX_SPLIT */
     memp_free(MEMP_TCPIP_MSG_INPKT, msg);
     return ERR_MEM;
   }
@@ -249,6 +324,9 @@ tcpip_callback_with_block(tcpip_callback_fn function, void *ctx, u8_t block)
     sys_mbox_post(&mbox, msg);
   } else {
     if (sys_mbox_trypost(&mbox, msg) != ERR_OK) {
+#if TCPIP_MBOX_SPLIT
+      tcpip_mbox_stats.api_drop++;
+#endif /* TCPIP_MBOX_SPLIT */
       memp_free(MEMP_TCPIP_MSG_API, msg);
       return ERR_MEM;
     }
@@ -446,7 +524,15 @@ err_t
 tcpip_trycallback(struct tcpip_callback_msg* msg)
 {
   LWIP_ASSERT("Invalid mbox", sys_mbox_valid_val(mbox));
+#if TCPIP_MBOX_SPLIT
+  if (sys_mbox_trypost(&mbox, msg) != ERR_OK) {
+    tcpip_mbox_stats.api_drop++;
+    return ERR_MEM;
+  }
+  return ERR_OK;
+#else /* TCPIP_MBOX_SPLIT */
   return sys_mbox_trypost(&mbox, msg);
+#endif /* TCPIP_MBOX_SPLIT */
 }
 
 /**
@@ -468,6 +554,11 @@ tcpip_init(tcpip_init_done_fn initfunc, void *arg)
   if (sys_mbox_new(&mbox, TCPIP_MBOX_SIZE) != ERR_OK) {
     LWIP_ASSERT("failed to create tcpip_thread mbox", 0);
   }
+#if TCPIP_MBOX_SPLIT
+  if (sys_mbox_new(&mbox_in, TCPIP_INPUT_MBOX_SIZE) != ERR_OK) {
+    LWIP_ASSERT("failed to create tcpip_thread input mbox", 0);
+  }
+#endif /* TCPIP_MBOX_SPLIT */
 #if LWIP_TCPIP_CORE_LOCKING
   if (sys_mutex_new(&lock_tcpip_core) != ERR_OK) {
     LWIP_ASSERT("failed to create lock_tcpip_core", 0);
@@ -108,9 +108,21 @@ const struct lwip_cyclic_timer lwip_cyclic_timers[] = {
 
 #if LWIP_TIMERS && !LWIP_TIMERS_CUSTOM
 
+#if LWIP_TIMERS_WHEEL
+/** [WizIO] timer wheel instead of the sorted list, sys_timeout() and
+ * sys_untimeout() do not walk the pending timeouts */
+#define SYS_TIMEO_HASH 16
+#define SYS_TIMEO_BUCKET(h, arg) \
+  (((((mem_ptr_t)(h)) >> 2) ^ (((mem_ptr_t)(arg)) >> 3)) & (SYS_TIMEO_HASH - 1))
+static twheel_t timeouts_wheel;
+static struct sys_timeo *timeouts_hash[SYS_TIMEO_HASH];
+#define SYS_TIMEOUTS_EMPTY() (timeouts_wheel.count == 0)
+#else /* LWIP_TIMERS_WHEEL */
 /** The one and only timeout list */
 static struct sys_timeo *next_timeout;
 static u32_t timeouts_last_time;
+#define SYS_TIMEOUTS_EMPTY() (next_timeout == NULL)
+#endif /* LWIP_TIMERS_WHEEL */
 
 #if LWIP_TCP
 /** global variable that shows if the tcp timer is currently scheduled or not */
@@ -175,6 +187,9 @@ cyclic_timer(void *arg)
 void sys_timeouts_init(void)
 {
   size_t i;
+#if LWIP_TIMERS_WHEEL
+  twheel_init(&timeouts_wheel, sys_now());
+#endif /* LWIP_TIMERS_WHEEL */
   /* tcp_tmr() at index 0 is started on demand */
   for (i = 1; i < LWIP_ARRAYSIZE(lwip_cyclic_timers); i++) {
     /* we have to cast via size_t to get rid of const warning
@@ -182,8 +197,10 @@ void sys_timeouts_init(void)
     sys_timeout(lwip_cyclic_timers[i].interval_ms, cyclic_timer, LWIP_CONST_CAST(void*, &lwip_cyclic_timers[i]));
   }
 
+#if !LWIP_TIMERS_WHEEL
   /* Initialise timestamp for sys_check_timeouts */
   timeouts_last_time = sys_now();
+#endif /* !LWIP_TIMERS_WHEEL */
 }
 
 /**
@@ -204,6 +221,29 @@ void
 sys_timeout(u32_t msecs, sys_timeout_handler handler, void *arg)
 #endif /* LWIP_DEBUG_TIMERNAMES */
 {
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo *timeout;
+  u8_t bucket;
+
+  timeout = (struct sys_timeo *)memp_malloc(MEMP_SYS_TIMEOUT);
+  if (timeout == NULL) {
+    LWIP_ASSERT("sys_timeout: timeout != NULL, pool MEMP_SYS_TIMEOUT is empty", timeout != NULL);
+    return;
+  }
+
+  timeout->h = handler;
+  timeout->arg = arg;
+#if LWIP_DEBUG_TIMERNAMES
+  timeout->handler_name = handler_name;
+  LWIP_DEBUGF(TIMERS_DEBUG, ("sys_timeout: %p msecs=%"U32_F" handler=%s arg=%p\n",
+    (void *)timeout, msecs, handler_name, (void *)arg));
+#endif /* LWIP_DEBUG_TIMERNAMES */
+
+  bucket = SYS_TIMEO_BUCKET(handler, arg);
+  timeout->hnext = timeouts_hash[bucket];
+  timeouts_hash[bucket] = timeout;
+  twheel_add(&timeouts_wheel, &timeout->node, sys_now() + msecs);
+#else /* LWIP_TIMERS_WHEEL */
   struct sys_timeo *timeout, *t;
   u32_t now, diff;
 
@@ -259,6 +299,7 @@ sys_timeout(u32_t msecs, sys_timeout_handler handler, void *arg)
       }
     }
   }
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /**
@@ -272,6 +313,23 @@ sys_timeout(u32_t msecs, sys_timeout_handler handler, void *arg)
 void
 sys_untimeout(sys_timeout_handler handler, void *arg)
 {
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo **pt, **first = NULL, *t;
+
+  /* the first one to expire, like the list version */
+  for (pt = &timeouts_hash[SYS_TIMEO_BUCKET(handler, arg)]; *pt != NULL; pt = &(*pt)->hnext) {
+    if (((*pt)->h == handler) && ((*pt)->arg == arg) &&
+        ((first == NULL) || ((s32_t)((*pt)->node.expire - (*first)->node.expire) < 0))) {
+      first = pt;
+    }
+  }
+  if (first != NULL) {
+    t = *first;
+    *first = t->hnext;
+    twheel_del(&timeouts_wheel, &t->node);
+    memp_free(MEMP_SYS_TIMEOUT, t);
+  }
+#else /* LWIP_TIMERS_WHEEL */
   struct sys_timeo *prev_t, *t;
 
   if (next_timeout == NULL) {
@@ -295,6 +353,7 @@ sys_untimeout(sys_timeout_handler handler, void *arg)
       return;
     }
   }
+#endif /* LWIP_TIMERS_WHEEL */
   return;
 }
 
@@ -306,12 +365,52 @@ sys_untimeout(sys_timeout_handler handler, void *arg)
  *
  * Must be called periodically from your main loop.
  */
-#if !NO_SYS && !defined __DOXYGEN__
-static
+#if LWIP_TIMERS_WHEEL
+/** twheel_advance() callback, the node is out of the wheel already */
+static void
+sys_timeout_expired(twheel_node_t *node, void *ctx)
+{
+  struct sys_timeo *tmptimeout = (struct sys_timeo *)node;
+  struct sys_timeo **pt;
+  sys_timeout_handler handler;
+  void *arg;
+  LWIP_UNUSED_ARG(ctx);
+
+  handler = tmptimeout->h;
+  arg = tmptimeout->arg;
+  for (pt = &timeouts_hash[SYS_TIMEO_BUCKET(handler, arg)]; *pt != tmptimeout; pt = &(*pt)->hnext);
+  *pt = tmptimeout->hnext;
+#if LWIP_DEBUG_TIMERNAMES
+  if (handler != NULL) {
+    LWIP_DEBUGF(TIMERS_DEBUG, ("sct calling h=%s arg=%p\n",
+      tmptimeout->handler_name, arg));
+  }
+#endif /* LWIP_DEBUG_TIMERNAMES */
+  memp_free(MEMP_SYS_TIMEOUT, tmptimeout);
+  PBUF_CHECK_FREE_OOSEQ();
+  if (handler != NULL) {
+#if !NO_SYS
+    LOCK_TCPIP_CORE();
+#endif /* !NO_SYS */
+    handler(arg);
+#if !NO_SYS
+    UNLOCK_TCPIP_CORE();
 #endif /* !NO_SYS */
+  }
+  LWIP_TCPIP_THREAD_ALIVE();
+}
+#endif /* LWIP_TIMERS_WHEEL */
+
+#if !NO_SYS && !TCPIP_MBOX_SPLIT && !defined __DOXYGEN__
+static
+#endif /* !NO_SYS && !TCPIP_MBOX_SPLIT */
 void
 sys_check_timeouts(void)
 {
+#if LWIP_TIMERS_WHEEL
+  PBUF_CHECK_FREE_OOSEQ();
+  twheel_advance(&timeouts_wheel, sys_now(), sys_timeout_expired, NULL);
+#else /* LWIP_TIMERS_WHEEL */
   if (next_timeout) {
     struct sys_timeo *tmptimeout;
     u32_t diff;
@@ -358,6 +457,7 @@ sys_check_timeouts(void)
     /* repeat until all expired timers have been called */
     } while (had_one);
   }
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /** Set back the timestamp of the last call to sys_check_timeouts()
@@ -368,19 +468,32 @@ sys_check_timeouts(void)
 void
 sys_restart_timeouts(void)
 {
+#if LWIP_TIMERS_WHEEL
+  twheel_rebase(&timeouts_wheel, sys_now());
+#else /* LWIP_TIMERS_WHEEL */
   timeouts_last_time = sys_now();
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /** Return the time left before the next timeout is due. If no timeouts are
  * enqueued, returns 0xffffffff
  */
-#if !NO_SYS
+#if !NO_SYS && !TCPIP_MBOX_SPLIT
 static
-#endif /* !NO_SYS */
+#endif /* !NO_SYS && !TCPIP_MBOX_SPLIT */
 u32_t
 sys_timeouts_sleeptime(void)
 {
   u32_t diff;
+#if LWIP_TIMERS_WHEEL
+  /* the next expiry, or the next cascade of a higher level of the wheel */
+  diff = twheel_next(&timeouts_wheel);
+  if (diff == TWHEEL_IDLE) {
+    return 0xffffffff;
+  }
+  diff += timeouts_wheel.now - sys_now();
+  return ((s32_t)diff < 0) ? 0 : diff;
+#else /* LWIP_TIMERS_WHEEL */
   if (next_timeout == NULL) {
     return 0xffffffff;
   }
@@ -390,6 +503,7 @@ sys_timeouts_sleeptime(void)
   } else {
     return next_timeout->time - diff;
   }
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 #if !NO_SYS
@@ -407,7 +521,7 @@ sys_timeouts_mbox_fetch(sys_mbox_t *mbox, void **msg)
   u32_t sleeptime;
 
 again:
-  if (!next_timeout) {
+  if (SYS_TIMEOUTS_EMPTY()) {
     sys_arch_mbox_fetch(mbox, msg, 0);
     return;
   }
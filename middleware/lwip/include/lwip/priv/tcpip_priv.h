@@ -52,6 +52,22 @@ extern "C" {
 struct pbuf;
 struct netif;
 
+#if TCPIP_MBOX_SPLIT
+/* [WizIO] separate mailbox for received packets, see lwipopts.h */
+#if !SYS_MBOX_MPSC
+#error "TCPIP_MBOX_SPLIT needs SYS_MBOX_MPSC, the tcpip thread sleeps on two mailboxes"
+#endif
+#ifndef TCPIP_INPUT_MBOX_SIZE
+#define TCPIP_INPUT_MBOX_SIZE   TCPIP_MBOX_SIZE
+#endif
+#ifndef TCPIP_API_BURST
+#define TCPIP_API_BURST         8
+#endif
+#ifndef TCPIP_INPUT_BURST
+#define TCPIP_INPUT_BURST       4
+#endif
+#endif /* TCPIP_MBOX_SPLIT */
+
 #if LWIP_MPU_COMPATIBLE
 #define API_VAR_REF(name)               (*(name))
 #define API_VAR_DECLARE(type, name)     type * name
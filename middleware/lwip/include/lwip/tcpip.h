@@ -92,6 +92,17 @@ err_t  tcpip_trycallback(struct tcpip_callback_msg* msg);
 err_t  pbuf_free_callback(struct pbuf *p);
 err_t  mem_free_callback(void *m);
 
+#if TCPIP_MBOX_SPLIT
+/** [WizIO] counters of the two tcpip_thread mailboxes */
+struct tcpip_mbox_stats {
+  u32_t in_done;    /* received packets processed */
+  u32_t in_drop;    /* received packets dropped: input mailbox full or MEMP_TCPIP_MSG_INPKT empty */
+  u32_t api_done;   /* API calls, callbacks and timeouts processed */
+  u32_t api_drop;   /* non-blocking callbacks failed: mailbox full */
+};
+extern struct tcpip_mbox_stats tcpip_mbox_stats;
+#endif /* TCPIP_MBOX_SPLIT */
+
 #if LWIP_TCPIP_TIMEOUT && LWIP_TIMERS
 err_t  tcpip_timeout(u32_t msecs, sys_timeout_handler h, void *arg);
 err_t  tcpip_untimeout(sys_timeout_handler h, void *arg);
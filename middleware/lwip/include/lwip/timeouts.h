@@ -44,6 +44,13 @@
 #include "lwip/sys.h"
 #endif
 
+#ifndef LWIP_TIMERS_WHEEL
+#define LWIP_TIMERS_WHEEL 0
+#endif
+#if LWIP_TIMERS_WHEEL
+#include "twheel.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -84,8 +91,14 @@ extern const struct lwip_cyclic_timer lwip_cyclic_timers[];
 typedef void (* sys_timeout_handler)(void *arg);
 
 struct sys_timeo {
+#if LWIP_TIMERS_WHEEL
+  /* [WizIO] timer wheel node and (handler, arg) hash chain for sys_untimeout() */
+  twheel_node_t node;
+  struct sys_timeo *hnext;
+#else /* LWIP_TIMERS_WHEEL */
   struct sys_timeo *next;
   u32_t time;
+#endif /* LWIP_TIMERS_WHEEL */
   sys_timeout_handler h;
   void *arg;
 #if LWIP_DEBUG_TIMERNAMES
@@ -109,6 +122,11 @@ void sys_check_timeouts(void);
 u32_t sys_timeouts_sleeptime(void);
 #else /* NO_SYS */
 void sys_timeouts_mbox_fetch(sys_mbox_t *mbox, void **msg);
+#if TCPIP_MBOX_SPLIT
+/* [WizIO] the tcpip thread runs the timeouts itself between its two mailboxes */
+void sys_check_timeouts(void);
+u32_t sys_timeouts_sleeptime(void);
+#endif /* TCPIP_MBOX_SPLIT */
 #endif /* NO_SYS */
 
 
@@ -14,6 +14,24 @@
 #define DEFAULT_UDP_RECVMBOX_SIZE       16
 #define DEFAULT_TCP_RECVMBOX_SIZE       16
 #define DEFAULT_ACCEPTMBOX_SIZE         16
+#define SYS_MBOX_MPSC                   1 /* lock-free mailboxes ( mpsc.h ), 0 for FreeRTOS queues, one reader per mailbox */
+#define SYS_SEM_NOTIFY                  1 /* sys_sem on task notifications, 0 for FreeRTOS semaphores, one waiter per semaphore */
+#define LWIP_TIMERS_WHEEL               1 /* sys_timeout on a timer wheel ( twheel.h ), 0 for the sorted list */
+
+/* received packets in their own tcpip mailbox, the thread takes up to TCPIP_API_BURST API messages
+   then up to TCPIP_INPUT_BURST packets, a socket call waits behind at most TCPIP_INPUT_BURST packets
+   0 for the single mailbox, needs SYS_MBOX_MPSC */
+#define TCPIP_MBOX_SPLIT                1
+#define TCPIP_INPUT_MBOX_SIZE           16
+#define TCPIP_API_BURST                 8
+#define TCPIP_INPUT_BURST               2
+
+/* one semaphore per thread for the blocking netconn / socket calls instead of one per netconn and call,
+   made on the first call, tasks that end call lwip_socket_thread_cleanup() before vTaskDelete() */
+#define LWIP_NETCONN_SEM_PER_THREAD     1
+#define LWIP_NETCONN_THREAD_SEM_GET()   sys_arch_netconn_sem_get()
+#define LWIP_NETCONN_THREAD_SEM_ALLOC() sys_arch_netconn_sem_alloc()
+#define LWIP_NETCONN_THREAD_SEM_FREE()  sys_arch_netconn_sem_free()
 
 #define LWIP_RAW                        1 /* for ping */
 
@@ -42,12 +60,23 @@
    byte alignment -> define MEM_ALIGNMENT to 2. */
 #define MEM_ALIGNMENT           4
 
+/**
+ * LWIP_USE_MEMP_POOLS==1: pcbs, segments, pbuf headers, netconns, messages
+ * and timeouts come from static fixed-size memp pools (O(1), guarded by
+ * SYS_ARCH_PROTECT) instead of pvPortMalloc. Set to 0 for the old behaviour.
+ */
+#define LWIP_USE_MEMP_POOLS     1
+
 /**
 * MEMP_MEM_MALLOC==1: Use mem_malloc/mem_free instead of the lwip pool allocator.
 * Especially useful with MEM_LIBC_MALLOC but handle with care regarding execution
 * speed and usage from interrupts!
 */
+#if LWIP_USE_MEMP_POOLS
+#define MEMP_MEM_MALLOC         0
+#else
 #define MEMP_MEM_MALLOC         1
+#endif
 
 
 /* MEM_SIZE: the size of the heap memory. If the application will send
@@ -82,7 +111,11 @@ a lot of data that needs to be copied, this should be set high. */
 #define MEMP_NUM_TCP_PCB_LISTEN 16
 /* MEMP_NUM_TCP_SEG: the number of simultaneously queued TCP
    segments. */
+#if LWIP_USE_MEMP_POOLS
+#define MEMP_NUM_TCP_SEG        (2 * TCP_SND_QUEUELEN)
+#else
 #define MEMP_NUM_TCP_SEG        255
+#endif
 
 /**
  * MEMP_NUM_ARP_QUEUE: the number of simulateously queued outgoing
@@ -99,13 +132,33 @@ a lot of data that needs to be copied, this should be set high. */
  */
 #define MEMP_NUM_NETCONN        8
 
+/**
+ * Pools below only matter with LWIP_USE_MEMP_POOLS. Check the high-water
+ * marks with bench_memp() (lwip_stats.memp[]->max) before trimming them.
+ */
+/* MEMP_NUM_TCPIP_MSG_INPKT: one per received packet waiting in the tcpip mbox */
+#if TCPIP_MBOX_SPLIT
+#define MEMP_NUM_TCPIP_MSG_INPKT TCPIP_INPUT_MBOX_SIZE
+#else
+#define MEMP_NUM_TCPIP_MSG_INPKT TCPIP_MBOX_SIZE
+#endif
+#define MEMP_NUM_TCPIP_MSG_API  8
+/* MEMP_NUM_SYS_TIMEOUT: lwIP internal timeouts + sntp + loopback polling */
+#define MEMP_NUM_SYS_TIMEOUT    (LWIP_TCP + IP_REASSEMBLY + LWIP_ARP + (2*LWIP_DHCP) + LWIP_DNS + 4)
+#define MEMP_NUM_NETBUF         4
+
 /*
    ----------------------------------
    ---------- Pbuf options ----------
    ----------------------------------
 */
-/* PBUF_POOL_SIZE: the number of buffers in the pbuf pool. */
+/* PBUF_POOL_SIZE: the number of buffers in the pbuf pool.
+   A static pool must cover the whole TCP_WND (lwip_sanity_check) */
+#if LWIP_USE_MEMP_POOLS
+#define PBUF_POOL_SIZE          16
+#else
 #define PBUF_POOL_SIZE          10
+#endif
 
 /* PBUF_POOL_BUFSIZE: the size of each pbuf in the pbuf pool. */
 #define PBUF_POOL_BUFSIZE       1664
@@ -36,20 +36,57 @@
 #include "task.h"
 #include "queue.h"
 #include "semphr.h"
+#include "lwipopts.h"
 
+#if SYS_MBOX_MPSC
+#include "mpsc.h"
+#define SYS_MBOX_NULL					( ( mpsc_t * ) NULL )
+#else
 #define SYS_MBOX_NULL					( ( QueueHandle_t ) NULL )
-#define SYS_SEM_NULL					( ( SemaphoreHandle_t ) NULL )
+#endif
 #define SYS_DEFAULT_THREAD_STACK_DEPTH	configMINIMAL_STACK_SIZE
 
+#if SYS_SEM_NOTIFY
+/* binary semaphore, the single waiter sleeps on a task notification bit */
+typedef struct {
+    volatile uint32_t count;
+    TaskHandle_t volatile waiter;
+    uint32_t valid;
+} sys_sem_t;
+#define SYS_SEM_NOTIFY_BIT              (1u << 1) /* bit 0 is MPSC_NOTIFY_BIT */
+#else
 typedef SemaphoreHandle_t sys_sem_t;
+#define SYS_SEM_NULL					( ( SemaphoreHandle_t ) NULL )
+#endif
 typedef SemaphoreHandle_t sys_mutex_t;
+#if SYS_MBOX_MPSC
+typedef mpsc_t * sys_mbox_t;
+#else
 typedef QueueHandle_t sys_mbox_t;
+#endif
 typedef TaskHandle_t sys_thread_t;
 
 #define sys_mbox_valid( x ) ( ( ( *x ) == NULL) ? pdFALSE : pdTRUE )
 #define sys_mbox_set_invalid( x ) ( ( *x ) = NULL )
+#if SYS_SEM_NOTIFY
+#define sys_sem_valid( x ) ( ( x )->valid ? pdTRUE : pdFALSE )
+#define sys_sem_set_invalid( x ) ( ( x )->valid = 0 )
+#else
 #define sys_sem_valid( x ) ( ( ( *x ) == NULL) ? pdFALSE : pdTRUE )
 #define sys_sem_set_invalid( x ) ( ( *x ) = NULL )
+#endif
+
+#if SYS_MBOX_MPSC
+/* the tcpip thread sleeps on its API and input mailboxes, TCPIP_MBOX_SPLIT */
+u32_t sys_arch_mbox_wait2(sys_mbox_t *pxMailBoxA, sys_mbox_t *pxMailBoxB, u32_t ulTimeOut);
+#endif
+
+#if LWIP_NETCONN_SEM_PER_THREAD
+#define SYS_ARCH_SEM_INDEX              1 /* FreeRTOS thread local storage pointer, 0 is TLS_ARENA_INDEX */
+sys_sem_t * sys_arch_netconn_sem_get(void);
+void sys_arch_netconn_sem_alloc(void);
+void sys_arch_netconn_sem_free(void);
+#endif
 
 
 #endif /* __ARCH_SYS_ARCH_H__ */
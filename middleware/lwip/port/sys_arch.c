@@ -54,6 +54,18 @@
 #include "lwip/mem.h"
 #include "lwip/stats.h"
 
+#include "rtos_static.h"
+
+#if SYS_MBOX_MPSC && (TCPIP_MBOX_SIZE > MPSC_MAX || DEFAULT_TCP_RECVMBOX_SIZE > MPSC_MAX || \
+    DEFAULT_UDP_RECVMBOX_SIZE > MPSC_MAX || DEFAULT_RAW_RECVMBOX_SIZE > MPSC_MAX || DEFAULT_ACCEPTMBOX_SIZE > MPSC_MAX)
+#error "lwIP mailbox larger than MPSC_MAX"
+#endif
+
+#if configUSE_STATIC_OBJECTS && (TCPIP_MBOX_SIZE > RTOS_STATIC_QUEUE_ITEMS || DEFAULT_TCP_RECVMBOX_SIZE > RTOS_STATIC_QUEUE_ITEMS || \
+    DEFAULT_UDP_RECVMBOX_SIZE > RTOS_STATIC_QUEUE_ITEMS || DEFAULT_RAW_RECVMBOX_SIZE > RTOS_STATIC_QUEUE_ITEMS || DEFAULT_ACCEPTMBOX_SIZE > RTOS_STATIC_QUEUE_ITEMS)
+#error "lwIP mailbox larger than RTOS_STATIC_QUEUE_ITEMS"
+#endif
+
 /* Very crude mechanism used to determine if the critical section handling
 functions are being called from an interrupt context or not.  This relies on
 the interrupt handler setting this variable manually. */
@@ -71,7 +83,11 @@ portBASE_TYPE xInsideISR = pdFALSE;
  *---------------------------------------------------------------------------*/
 err_t sys_mbox_new(sys_mbox_t *pxMailBox, int iSize) {
     err_t xReturn = ERR_MEM;
-    *pxMailBox = xQueueCreate(iSize, sizeof ( void *));
+#if SYS_MBOX_MPSC
+    *pxMailBox = rtos_mpsc(iSize);
+#else
+    *pxMailBox = rtos_queue(iSize);
+#endif
     if (*pxMailBox != NULL) {
         xReturn = ERR_OK;
         SYS_STATS_INC_USED(mbox);
@@ -93,7 +109,11 @@ err_t sys_mbox_new(sys_mbox_t *pxMailBox, int iSize) {
  *---------------------------------------------------------------------------*/
 void sys_mbox_free(sys_mbox_t *pxMailBox) {
     unsigned long ulMessagesWaiting;
+#if SYS_MBOX_MPSC
+    ulMessagesWaiting = mpsc_count(*pxMailBox);
+#else
     ulMessagesWaiting = uxQueueMessagesWaiting(*pxMailBox);
+#endif
     configASSERT((ulMessagesWaiting == 0));
 #if SYS_STATS
     {
@@ -103,7 +123,11 @@ void sys_mbox_free(sys_mbox_t *pxMailBox) {
         SYS_STATS_DEC(mbox.used);
     }
 #endif /* SYS_STATS */
-    vQueueDelete(*pxMailBox);
+#if SYS_MBOX_MPSC
+    rtos_mpsc_delete(*pxMailBox);
+#else
+    rtos_delete(*pxMailBox);
+#endif
 }
 
 /*---------------------------------------------------------------------------*
@@ -116,7 +140,12 @@ void sys_mbox_free(sys_mbox_t *pxMailBox) {
  *      void *data              -- Pointer to data to post
  *---------------------------------------------------------------------------*/
 void sys_mbox_post(sys_mbox_t *pxMailBox, void *pxMessageToPost) {
+#if SYS_MBOX_MPSC
+    while (!mpsc_push(*pxMailBox, pxMessageToPost))
+        vTaskDelay(1); // full, the reader runs at TCPIP_THREAD_PRIO or is the poster itself
+#else
     while (xQueueSendToBack(*pxMailBox, &pxMessageToPost, portMAX_DELAY) != pdTRUE);
+#endif
 }
 
 /*---------------------------------------------------------------------------*
@@ -134,12 +163,16 @@ void sys_mbox_post(sys_mbox_t *pxMailBox, void *pxMessageToPost) {
  *---------------------------------------------------------------------------*/
 err_t sys_mbox_trypost(sys_mbox_t *pxMailBox, void *pxMessageToPost) {
     err_t xReturn;
+#if SYS_MBOX_MPSC
+    xReturn = mpsc_push(*pxMailBox, pxMessageToPost) ? pdPASS : pdFAIL;
+#else
     portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
     if (xInsideISR != pdFALSE) {
         xReturn = xQueueSendFromISR(*pxMailBox, &pxMessageToPost, &xHigherPriorityTaskWoken);
     } else {
         xReturn = xQueueSend(*pxMailBox, &pxMessageToPost, (TickType_t) 0);
     }
+#endif
     if (xReturn == pdPASS) {
         xReturn = ERR_OK;
     } else {
@@ -185,7 +218,11 @@ u32_t sys_arch_mbox_fetch(sys_mbox_t *pxMailBox, void **ppvBuffer, u32_t ulTimeO
     }
     if (ulTimeOut != 0UL) {
         configASSERT(xInsideISR == (portBASE_TYPE) 0);
+#if SYS_MBOX_MPSC
+        if (mpsc_fetch(*pxMailBox, ppvBuffer, ulTimeOut / portTICK_PERIOD_MS)) {
+#else
         if (pdTRUE == xQueueReceive(*pxMailBox, &(*ppvBuffer), ulTimeOut / portTICK_PERIOD_MS)) {
+#endif
             xEndTime = xTaskGetTickCount();
             xElapsed = (xEndTime - xStartTime) * portTICK_PERIOD_MS;
             ulReturn = xElapsed;
@@ -195,7 +232,11 @@ u32_t sys_arch_mbox_fetch(sys_mbox_t *pxMailBox, void **ppvBuffer, u32_t ulTimeO
             ulReturn = SYS_ARCH_TIMEOUT;
         }
     } else {
+#if SYS_MBOX_MPSC
+        while (!mpsc_fetch(*pxMailBox, ppvBuffer, portMAX_DELAY));
+#else
         while (pdTRUE != xQueueReceive(*pxMailBox, &(*ppvBuffer), portMAX_DELAY));
+#endif
         xEndTime = xTaskGetTickCount();
         xElapsed = (xEndTime - xStartTime) * portTICK_PERIOD_MS;
         if (xElapsed == 0UL) {
@@ -228,11 +269,15 @@ u32_t sys_arch_mbox_tryfetch(sys_mbox_t *pxMailBox, void **ppvBuffer) {
     if (ppvBuffer == NULL) {
         ppvBuffer = &pvDummy;
     }
+#if SYS_MBOX_MPSC
+    lResult = mpsc_pop(*pxMailBox, ppvBuffer) ? pdPASS : pdFAIL;
+#else
     if (xInsideISR != pdFALSE) {
         lResult = xQueueReceiveFromISR(*pxMailBox, &(*ppvBuffer), &xHigherPriorityTaskWoken);
     } else {
         lResult = xQueueReceive(*pxMailBox, &(*ppvBuffer), 0UL);
     }
+#endif
     if (lResult == pdPASS) {
         ulReturn = ERR_OK;
     } else {
@@ -241,6 +286,30 @@ u32_t sys_arch_mbox_tryfetch(sys_mbox_t *pxMailBox, void **ppvBuffer) {
     return ulReturn;
 }
 
+#if SYS_MBOX_MPSC
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_mbox_wait2
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Blocks until one of two mailboxes holds a message, nothing is
+ *      fetched. The caller must be the only reader of both.
+ * Inputs:
+ *      sys_mbox_t mboxA, mboxB -- Handles of the mailboxes
+ *      u32_t timeout           -- Number of milliseconds until timeout, 0 forever
+ * Outputs:
+ *      u32_t                   -- SYS_ARCH_TIMEOUT if timeout, else 0
+ *---------------------------------------------------------------------------*/
+u32_t sys_arch_mbox_wait2(sys_mbox_t *pxMailBoxA, sys_mbox_t *pxMailBoxB, u32_t ulTimeOut) {
+    TickType_t xTicks = ulTimeOut ? ulTimeOut / portTICK_PERIOD_MS : portMAX_DELAY;
+    configASSERT(xInsideISR == (portBASE_TYPE) 0);
+    if (mpsc_wait2(*pxMailBoxA, *pxMailBoxB, xTicks))
+        return 0;
+    return SYS_ARCH_TIMEOUT;
+}
+
+#endif
+
 /*---------------------------------------------------------------------------*
  * Routine:  sys_sem_new
  *---------------------------------------------------------------------------*
@@ -254,12 +323,24 @@ u32_t sys_arch_mbox_tryfetch(sys_mbox_t *pxMailBox, void **ppvBuffer) {
  * Outputs:
  *      sys_sem_t               -- Created semaphore or 0 if could not create.
  *---------------------------------------------------------------------------*/
+#if SYS_SEM_NOTIFY
+
+err_t sys_sem_new(sys_sem_t *pxSemaphore, u8_t ucCount) {
+    pxSemaphore->count = (ucCount != 0U);
+    pxSemaphore->waiter = NULL;
+    pxSemaphore->valid = 1;
+    SYS_STATS_INC_USED(sem);
+    return ERR_OK;
+}
+
+#else
+
 err_t sys_sem_new(sys_sem_t *pxSemaphore, u8_t ucCount) {
     err_t xReturn = ERR_MEM;
-    vSemaphoreCreateBinary((*pxSemaphore));
+    *pxSemaphore = rtos_sem_binary();
     if (*pxSemaphore != NULL) {
-        if (ucCount == 0U) {
-            xSemaphoreTake(*pxSemaphore, 1UL);
+        if (ucCount != 0U) {
+            xSemaphoreGive(*pxSemaphore);
         }
         xReturn = ERR_OK;
         SYS_STATS_INC_USED(sem);
@@ -269,6 +350,8 @@ err_t sys_sem_new(sys_sem_t *pxSemaphore, u8_t ucCount) {
     return xReturn;
 }
 
+#endif
+
 /*---------------------------------------------------------------------------*
  * Routine:  sys_arch_sem_wait
  *---------------------------------------------------------------------------*
@@ -292,6 +375,41 @@ err_t sys_sem_new(sys_sem_t *pxSemaphore, u8_t ucCount) {
  * Outputs:
  *      u32_t                   -- Time elapsed or SYS_ARCH_TIMEOUT.
  *---------------------------------------------------------------------------*/
+#if SYS_SEM_NOTIFY
+
+/* the waiter is published before the last look at the count, sys_sem_signal() sets the count before it reads the waiter */
+u32_t sys_arch_sem_wait(sys_sem_t *pxSemaphore, u32_t ulTimeout) {
+    TickType_t xStartTime, xElapsed, xTicks;
+    TimeOut_t xTimeOut;
+    xStartTime = xTaskGetTickCount();
+    if (!__sync_lock_test_and_set(&pxSemaphore->count, 0)) {
+        xTicks = (ulTimeout != 0UL) ? ulTimeout / portTICK_PERIOD_MS : portMAX_DELAY;
+        vTaskSetTimeOutState(&xTimeOut);
+        for (;;) {
+            pxSemaphore->waiter = xTaskGetCurrentTaskHandle();
+            __sync_synchronize();
+            if (__sync_lock_test_and_set(&pxSemaphore->count, 0))
+                break;
+            if (xTaskCheckForTimeOut(&xTimeOut, &xTicks)) {
+                pxSemaphore->waiter = NULL;
+                __sync_synchronize();
+                /* drop a signal that raced the timeout, a later one only costs the next wait a loop */
+                xTaskNotifyWait(0, SYS_SEM_NOTIFY_BIT, NULL, 0);
+                return SYS_ARCH_TIMEOUT;
+            }
+            xTaskNotifyWait(0, SYS_SEM_NOTIFY_BIT, NULL, xTicks);
+        }
+        pxSemaphore->waiter = NULL;
+    }
+    xElapsed = (xTaskGetTickCount() - xStartTime) * portTICK_PERIOD_MS;
+    if (ulTimeout == 0UL && xElapsed == 0UL) {
+        xElapsed = 1UL;
+    }
+    return xElapsed;
+}
+
+#else
+
 u32_t sys_arch_sem_wait(sys_sem_t *pxSemaphore, u32_t ulTimeout) {
     TickType_t xStartTime, xEndTime, xElapsed;
     unsigned long ulReturn;
@@ -316,12 +434,14 @@ u32_t sys_arch_sem_wait(sys_sem_t *pxSemaphore, u32_t ulTimeout) {
     return ulReturn;
 }
 
+#endif
+
 /** Create a new mutex
  * @param mutex pointer to the mutex to create
  * @return a new mutex */
 err_t sys_mutex_new(sys_mutex_t *pxMutex) {
     err_t xReturn = ERR_MEM;
-    *pxMutex = xSemaphoreCreateMutex();
+    *pxMutex = rtos_mutex();
     if (*pxMutex != NULL) {
         xReturn = ERR_OK;
         SYS_STATS_INC_USED(mutex);
@@ -347,7 +467,7 @@ void sys_mutex_unlock(sys_mutex_t *pxMutex) {
  * @param mutex the mutex to delete */
 void sys_mutex_free(sys_mutex_t *pxMutex) {
     SYS_STATS_DEC(mutex.used);
-    vQueueDelete(*pxMutex);
+    rtos_delete(*pxMutex);
 }
 
 /*---------------------------------------------------------------------------*
@@ -359,12 +479,26 @@ void sys_mutex_free(sys_mutex_t *pxMutex) {
  *      sys_sem_t sem           -- Semaphore to signal
  *---------------------------------------------------------------------------*/
 void sys_sem_signal(sys_sem_t *pxSemaphore) {
+#if SYS_SEM_NOTIFY
+    TaskHandle_t xWaiter;
+    pxSemaphore->count = 1;
+    __sync_synchronize();
+    if ((xWaiter = pxSemaphore->waiter) != NULL) {
+        if (xInsideISR != pdFALSE) {
+            portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+            xTaskNotifyFromISR(xWaiter, SYS_SEM_NOTIFY_BIT, eSetBits, &xHigherPriorityTaskWoken);
+        } else {
+            xTaskNotify(xWaiter, SYS_SEM_NOTIFY_BIT, eSetBits);
+        }
+    }
+#else
     portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
     if (xInsideISR != pdFALSE) {
         xSemaphoreGiveFromISR(*pxSemaphore, &xHigherPriorityTaskWoken);
     } else {
         xSemaphoreGive(*pxSemaphore);
     }
+#endif
 }
 
 /*---------------------------------------------------------------------------*
@@ -377,9 +511,60 @@ void sys_sem_signal(sys_sem_t *pxSemaphore) {
  *---------------------------------------------------------------------------*/
 void sys_sem_free(sys_sem_t *pxSemaphore) {
     SYS_STATS_DEC(sem.used);
-    vQueueDelete(*pxSemaphore);
+#if SYS_SEM_NOTIFY
+    configASSERT(pxSemaphore->waiter == NULL);
+#else
+    rtos_delete(*pxSemaphore);
+#endif
 }
 
+#if LWIP_NETCONN_SEM_PER_THREAD
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_netconn_sem_get
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      LWIP_NETCONN_THREAD_SEM_GET(), the semaphore of the calling task,
+ *      made on the first blocking netconn call of the task
+ * Outputs:
+ *      sys_sem_t *             -- Thread local semaphore
+ *---------------------------------------------------------------------------*/
+sys_sem_t *sys_arch_netconn_sem_get(void) {
+    sys_sem_t *pxSemaphore = (sys_sem_t *) pvTaskGetThreadLocalStoragePointer(NULL, SYS_ARCH_SEM_INDEX);
+    if (pxSemaphore == NULL) {
+        sys_arch_netconn_sem_alloc();
+        pxSemaphore = (sys_sem_t *) pvTaskGetThreadLocalStoragePointer(NULL, SYS_ARCH_SEM_INDEX);
+        configASSERT(pxSemaphore != NULL);
+    }
+    return pxSemaphore;
+}
+
+void sys_arch_netconn_sem_alloc(void) {
+    sys_sem_t *pxSemaphore;
+    if (pvTaskGetThreadLocalStoragePointer(NULL, SYS_ARCH_SEM_INDEX) != NULL) {
+        return;
+    }
+    if ((pxSemaphore = (sys_sem_t *) pvPortMalloc(sizeof (sys_sem_t))) == NULL) {
+        return;
+    }
+    if (sys_sem_new(pxSemaphore, 0) != ERR_OK) {
+        vPortFree(pxSemaphore);
+        return;
+    }
+    vTaskSetThreadLocalStoragePointer(NULL, SYS_ARCH_SEM_INDEX, pxSemaphore);
+}
+
+void sys_arch_netconn_sem_free(void) {
+    sys_sem_t *pxSemaphore = (sys_sem_t *) pvTaskGetThreadLocalStoragePointer(NULL, SYS_ARCH_SEM_INDEX);
+    if (pxSemaphore != NULL) {
+        vTaskSetThreadLocalStoragePointer(NULL, SYS_ARCH_SEM_INDEX, NULL);
+        sys_sem_free(pxSemaphore);
+        vPortFree(pxSemaphore);
+    }
+}
+
+#endif /* LWIP_NETCONN_SEM_PER_THREAD */
+
 /*---------------------------------------------------------------------------*
  * Routine:  sys_init
  *---------------------------------------------------------------------------*
@@ -417,7 +602,7 @@ sys_thread_t sys_thread_new(const char *pcName, void( *pxThread)(void *pvParamet
     TaskHandle_t xCreatedTask;
     portBASE_TYPE xResult;
     sys_thread_t xReturn;
-    xResult = xTaskCreate(pxThread, pcName, iStackSize, pvArg, iPriority, &xCreatedTask);
+    xResult = rtos_task_create(pxThread, pcName, iStackSize, pvArg, iPriority, &xCreatedTask);
     if (xResult == pdPASS) {
         xReturn = xCreatedTask;
     } else {
@@ -472,7 +657,9 @@ void sys_arch_unprotect(sys_prot_t xValue) {
 
 void sys_assert(const char *pcMessage) {
     (void) pcMessage;
+    portDISABLE_INTERRUPTS();
     LOG("sys_assert : loop forever\n");
+    sys_log_flush();
     for (;;) {
     }
 }
@@ -8,8 +8,15 @@
 /* System support */
 #define MBEDTLS_HAVE_ASM
 #define MBEDTLS_PLATFORM_MEMORY
+#define MBEDTLS_PIC32_ARENA             (40 * 1024) /* per connection arena, port/tls_arena.c */
+#ifdef MBEDTLS_PIC32_ARENA
+#include "tls_arena.h"
+#define MBEDTLS_PLATFORM_CALLOC_MACRO   tls_calloc
+#define MBEDTLS_PLATFORM_FREE_MACRO     tls_free
+#else
 #define MBEDTLS_PLATFORM_CALLOC_MACRO   pvPortCalloc //mbedtls_calloc //
 #define MBEDTLS_PLATFORM_FREE_MACRO     vPortFree //mbedtls_free //
+#endif
 
 
 
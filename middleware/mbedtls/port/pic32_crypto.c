@@ -14,7 +14,7 @@ static void crypto_mutex_lock(void) {
     int state = xTaskGetSchedulerState();
     if (taskSCHEDULER_NOT_STARTED == state) return; // FOR SELF TEST in main()
     if (NULL == crypto_mutex) {
-        crypto_mutex = xSemaphoreCreateMutex();
+        crypto_mutex = rtos_mutex();
         if (NULL == crypto_mutex)
             vAssertCalled(__FILE__, __LINE__);
     }
@@ -0,0 +1,182 @@
+/*
+ * File:   tls_arena.c
+ *
+ * Chunks are [u32 size|FREE][u32 MAGIC|prev size][payload], 8 byte aligned
+ * Freeing the top chunk pops it together with the free chunks below it,
+ * other frees only mark the chunk, the space comes back when the stack unwinds to it
+ *
+ * tls_free looks the pointer up in tls_arenas, a chunk freed by another task is marked only,
+ * the owner pops it or it goes with the block. A chunk of a destroyed arena is recognised by
+ * ARENA_MAGIC in its header ( a heap_4 block has NULL and the allocated bit there ) and dropped
+ */
+
+#include "sys.h"
+#include "osal.h"
+#include "slab.h"
+#include "tls_arena.h"
+
+#define TLS_ARENA_MAGIC 0x544C5341u /* "TLSA" */
+#define ARENA_MAGIC     0x7A000000u /* high byte of arena_chunk_t.prev */
+#define ARENA_SIZE      0x00FFFFFFu /* arena and chunk sizes fit below ARENA_MAGIC */
+#define ARENA_FREE      0x80000000u
+#define ARENA_HDR       8u
+#define ARENA_ALIGN(S)  (((S) + 7u) & ~7u)
+
+typedef struct {
+    uint32_t size;
+    uint32_t prev;
+} arena_chunk_t;
+
+static tls_arena_t * tls_arenas; /* live arenas, taskENTER_CRITICAL */
+static uint32_t tls_arena_stale; /* frees of chunks after their arena was destroyed */
+
+static TaskHandle_t tls_arena_task(void) {
+    if (taskSCHEDULER_NOT_STARTED == xTaskGetSchedulerState())
+        return NULL;
+    return xTaskGetCurrentTaskHandle();
+}
+
+static tls_arena_t * tls_arena_current(void) {
+    if (taskSCHEDULER_NOT_STARTED == xTaskGetSchedulerState())
+        return NULL; // self test from main()
+    return (tls_arena_t *) pvTaskGetThreadLocalStoragePointer(NULL, TLS_ARENA_INDEX);
+}
+
+tls_arena_t * tls_arena_create(size_t size) {
+    tls_arena_t * arena;
+    configASSERT(NULL == tls_arena_current()); // one arena per task, destroy the first one before
+    size = ARENA_ALIGN(size + sizeof (tls_arena_t));
+    if (size > ARENA_SIZE || NULL == (arena = (tls_arena_t *) pvPortMalloc(size)))
+        return NULL;
+    memset(arena, 0, sizeof (tls_arena_t));
+    arena->magic = TLS_ARENA_MAGIC;
+    arena->owner = tls_arena_task();
+    arena->base = arena->top = (uint8_t *) arena + ARENA_ALIGN(sizeof (tls_arena_t));
+    arena->end = (uint8_t *) arena + size;
+    taskENTER_CRITICAL();
+    arena->next = tls_arenas;
+    tls_arenas = arena;
+    taskEXIT_CRITICAL();
+    if (arena->owner)
+        vTaskSetThreadLocalStoragePointer(NULL, TLS_ARENA_INDEX, arena);
+    return arena;
+}
+
+/* everything mbedTLS did not free goes with the block */
+void tls_arena_destroy(tls_arena_t * arena) {
+    tls_arena_t ** pa;
+    if (NULL == arena)
+        return;
+    configASSERT(TLS_ARENA_MAGIC == arena->magic);
+    configASSERT(arena->owner == tls_arena_task()); // the slot is in the TCB of the owner
+    if (tls_arena_current() == arena)
+        vTaskSetThreadLocalStoragePointer(NULL, TLS_ARENA_INDEX, NULL);
+    taskENTER_CRITICAL();
+    for (pa = &tls_arenas; *pa; pa = &(*pa)->next) {
+        if (*pa == arena) {
+            *pa = arena->next;
+            break;
+        }
+    }
+    arena->magic = 0;
+    taskEXIT_CRITICAL();
+    vPortFree(arena);
+}
+
+void tls_arena_dump(tls_arena_t * arena) {
+    if (NULL == arena)
+        return;
+    LOG("[TLS] arena %u peak %u used %u allocs %u frees %u foreign %u stale %u fallback %u avg %u ticks\n",
+            arena->end - arena->base, arena->peak, arena->top - arena->base, arena->allocs, arena->frees,
+            arena->foreign, tls_arena_stale, arena->fallbacks, arena->allocs ? arena->ticks / arena->allocs : 0);
+}
+
+static void * arena_alloc(tls_arena_t * arena, size_t size) {
+    arena_chunk_t * chunk;
+    if (size > ARENA_SIZE)
+        return NULL;
+    size = ARENA_ALIGN(size ? size : 1); // keeps ptr < end
+    if ((size_t) (arena->end - arena->top) < size + ARENA_HDR)
+        return NULL;
+    chunk = (arena_chunk_t *) arena->top;
+    chunk->size = size;
+    chunk->prev = ARENA_MAGIC | arena->last;
+    arena->last = size;
+    arena->top += size + ARENA_HDR;
+    if ((uint32_t) (arena->top - arena->base) > arena->peak)
+        arena->peak = arena->top - arena->base;
+    return chunk + 1;
+}
+
+static void arena_free(tls_arena_t * arena, void * ptr) {
+    arena_chunk_t * chunk = (arena_chunk_t *) ptr - 1;
+    if ((uint8_t *) (chunk + 1) + chunk->size != arena->top) {
+        chunk->size |= ARENA_FREE;
+        return;
+    }
+    arena->top = (uint8_t *) chunk;
+    arena->last = chunk->prev & ARENA_SIZE;
+    while (arena->top > arena->base) {
+        chunk = (arena_chunk_t *) (arena->top - arena->last - ARENA_HDR);
+        if (0 == (chunk->size & ARENA_FREE))
+            break;
+        arena->top = (uint8_t *) chunk;
+        arena->last = chunk->prev & ARENA_SIZE;
+    }
+}
+
+void * tls_calloc(size_t n, size_t size) {
+    tls_arena_t * arena = tls_arena_current();
+    uint32_t start = ReadCoreTimer();
+    void * ptr;
+    if (size && n > (size_t) - 1 / size)
+        return NULL;
+    size *= n;
+    if (NULL == arena)
+        return pvPortCalloc(1, size);
+    if (NULL == (ptr = arena_alloc(arena, size))) {
+        arena->fallbacks++;
+        return pvPortCalloc(1, size);
+    }
+    memset(ptr, 0, size);
+    arena->allocs++;
+    arena->ticks += ReadCoreTimer() - start;
+    return ptr;
+}
+
+void tls_free(void * ptr) {
+    arena_chunk_t * chunk = (arena_chunk_t *) ptr - 1;
+    TaskHandle_t task = tls_arena_task();
+    tls_arena_t * arena;
+    if (NULL == ptr)
+        return;
+    taskENTER_CRITICAL();
+    for (arena = tls_arenas; arena; arena = arena->next)
+        if ((uint8_t *) ptr >= arena->base && (uint8_t *) ptr < arena->end)
+            break;
+    if (arena && arena->owner != task) {
+        chunk->size |= ARENA_FREE; // the owner may be inside arena_free, top is left to it
+        arena->foreign++;
+        ptr = NULL;
+    }
+    taskEXIT_CRITICAL();
+    if (NULL == ptr)
+        return;
+    if (arena) {
+        configASSERT(TLS_ARENA_MAGIC == arena->magic);
+        arena->frees++;
+        arena_free(arena, ptr);
+        return;
+    }
+#if configUSE_SLAB
+    if (slab_size(ptr)) {
+        vPortFree(ptr);
+        return;
+    }
+#endif
+    if (chunk->size && ARENA_MAGIC == (chunk->prev & ~ARENA_SIZE)) {
+        tls_arena_stale++; // the memory went back to the heap with the arena block
+        return;
+    }
+    vPortFree(ptr);
+}
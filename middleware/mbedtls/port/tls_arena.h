@@ -0,0 +1,46 @@
+/*
+ * File:   tls_arena.h
+ *
+ * Per connection arena for mbedTLS, MBEDTLS_PIC32_ARENA in config-pic32-basic.h
+ * One block from the heap, LIFO bump allocation inside it, freed at once on close
+ * The arena is attached to the creating task, mbedtls_calloc of that task takes from it
+ * tls_free finds the arena by address in the list of live arenas, not by the calling task
+ */
+
+#ifndef TLS_ARENA_H
+#define	TLS_ARENA_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define TLS_ARENA_INDEX     0 /* FreeRTOS thread local storage pointer */
+
+typedef struct tls_arena_s {
+    uint32_t magic;     /* TLS_ARENA_MAGIC while live */
+    void * owner;       /* TaskHandle_t of the creating task, NULL before the scheduler */
+    struct tls_arena_s * next;
+    uint8_t * base, * top, * end;
+    uint32_t last;      /* payload size of the chunk below top */
+    uint32_t peak;      /* bytes */
+    uint32_t allocs, frees, fallbacks;
+    uint32_t foreign;   /* frees from another task, marked only */
+    uint32_t ticks;     /* core timer ticks spent in tls_calloc */
+} tls_arena_t;
+
+tls_arena_t * tls_arena_create(size_t size);
+void tls_arena_destroy(tls_arena_t * arena);
+void tls_arena_dump(tls_arena_t * arena);
+
+/* MBEDTLS_PLATFORM_CALLOC_MACRO / MBEDTLS_PLATFORM_FREE_MACRO */
+void * tls_calloc(size_t n, size_t size);
+void tls_free(void * ptr);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* TLS_ARENA_H */
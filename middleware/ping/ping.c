@@ -55,6 +55,9 @@
 #if PING_USE_SOCKETS
 #include "lwip/sockets.h"
 #include "lwip/inet.h"
+#if PING_USE_CORO
+#include "coro.h"
+#endif /* PING_USE_CORO */
 #endif /* PING_USE_SOCKETS */
 
 #if LWIP_IPV4
@@ -209,68 +212,196 @@ ping_send(int s, ip4_addr_t *addr, ping_static_t *p_ping_static) {
     return (err ? ERR_OK : ERR_VAL);
 }
 
-static void
-ping_recv(int s, ip4_addr_t *addr, ping_static_t *p_ping_static) {
-    char buf[64];
-    int fromlen, len;
-    struct sockaddr_in from;
+/* one received datagram: 1 the reply we wait for, -1 lost ( other traffic after the timeout ), 0 keep waiting */
+static int
+ping_recv_one(const char *buf, int len, struct sockaddr_in *from, ip4_addr_t *addr, ping_static_t *p_ping_static) {
     struct ip_hdr *iphdr;
     struct icmp_echo_hdr *iecho;
 
-    fromlen = sizeof (struct sockaddr_in);
-    while ((len = lwip_recvfrom(s, buf, sizeof (buf), 0, (struct sockaddr*) &from, (socklen_t*) & fromlen)) > 0) {
-        if (len >= (int) (sizeof (struct ip_hdr) + sizeof (struct icmp_echo_hdr))) {
-            ip4_addr_t fromaddr;
-            u32_t cur_time = sys_now() - p_ping_static->ping_time;
-
-            inet_addr_to_ipaddr(&fromaddr, &from.sin_addr);
-            /* LWIP_DEBUGF( PING_DEBUG, ("ping: recv ")); */
-            iphdr = (struct ip_hdr *) buf;
-            iecho = (struct icmp_echo_hdr *) (buf + (IPH_HL(iphdr) * 4));
-
-            /* ignore packet if it is not ping reply */
-            if ((0 != (iecho->type)) || ((addr->addr) != (fromaddr.addr))) {
-                if (cur_time > PING_RCV_TIMEO) {
-                    PING_LOGI("--- ping: timeout = %u", cur_time);
-                    p_ping_static->ping_lost_num = p_ping_static->ping_lost_num + 1;
-                    return;
-                } else {
-                    continue;
-                }
+    if (len >= (int) (sizeof (struct ip_hdr) + sizeof (struct icmp_echo_hdr))) {
+        ip4_addr_t fromaddr;
+        u32_t cur_time = sys_now() - p_ping_static->ping_time;
+
+        inet_addr_to_ipaddr(&fromaddr, &from->sin_addr);
+        /* LWIP_DEBUGF( PING_DEBUG, ("ping: recv ")); */
+        iphdr = (struct ip_hdr *) buf;
+        iecho = (struct icmp_echo_hdr *) (buf + (IPH_HL(iphdr) * 4));
+
+        /* ignore packet if it is not ping reply */
+        if ((0 != (iecho->type)) || ((addr->addr) != (fromaddr.addr))) {
+            if (cur_time > PING_RCV_TIMEO) {
+                PING_LOGI("--- ping: timeout = %u", cur_time);
+                p_ping_static->ping_lost_num = p_ping_static->ping_lost_num + 1;
+                return -1;
+            } else {
+                return 0;
+            }
+        }
+
+        if ((iecho->id == PING_ID) && (iecho->seqno == htons(p_ping_static->ping_seq_num))) {
+            PING_LOGI("ping: recv seq(0x%04X) %"U16_F".%"U16_F".%"U16_F".%"U16_F", %"U32_F" ms", \
+                                htons(iecho->seqno),             \
+                                ip4_addr1_16(&fromaddr),         \
+                                ip4_addr2_16(&fromaddr),         \
+                                ip4_addr3_16(&fromaddr),         \
+                                ip4_addr4_16(&fromaddr),         \
+                                cur_time);
+
+            /* LWIP_DEBUGF( PING_DEBUG, (" %"U32_F" ms\n", (sys_now() - ping_time))); */
+            if (p_ping_static->ping_min_time == 0 || p_ping_static->ping_min_time > cur_time) {
+                p_ping_static->ping_min_time = cur_time;
             }
+            if (p_ping_static->ping_max_time == 0 || p_ping_static->ping_max_time < cur_time) {
+                p_ping_static->ping_max_time = cur_time;
+            }
+            p_ping_static->ping_avg_time = p_ping_static->ping_avg_time + cur_time;
+
+            ping_done = 1;
+            p_ping_static->ping_recv_num = p_ping_static->ping_recv_num + 1;
+
+            /* do some ping result processing */
+            PING_RESULT((ICMPH_TYPE(iecho) == ICMP_ER));
+            return 1;
+        } else {
+            /* Treat ping ack received after timeout as success */
+            p_ping_static->ping_recv_num = p_ping_static->ping_recv_num + 1;
+            p_ping_static->ping_lost_num = p_ping_static->ping_lost_num - 1;
+            PING_LOGI("ping: Get ping ACK seq(0x%04X), expected seq(0x%04X)", htons(iecho->seqno), p_ping_static->ping_seq_num);
+            /* Can not return, due to there could be ping ack which has matched sequence num. */
+        }
+    }
+    return 0;
+}
+
+static void
+ping_report(ip4_addr_t *ping_target, ping_static_t *p_ping_static, ping_request_result_t callback) {
+    ping_result_t ping_result = {0};
+
+    p_ping_static->ping_avg_time = (int) ((p_ping_static->ping_avg_time) / p_ping_static->count);
 
-            if ((iecho->id == PING_ID) && (iecho->seqno == htons(p_ping_static->ping_seq_num))) {
-                PING_LOGI("ping: recv seq(0x%04X) %"U16_F".%"U16_F".%"U16_F".%"U16_F", %"U32_F" ms", \
-                                    htons(iecho->seqno),             \
-                                    ip4_addr1_16(&fromaddr),         \
-                                    ip4_addr2_16(&fromaddr),         \
-                                    ip4_addr3_16(&fromaddr),         \
-                                    ip4_addr4_16(&fromaddr),         \
-                                    cur_time);
-
-                /* LWIP_DEBUGF( PING_DEBUG, (" %"U32_F" ms\n", (sys_now() - ping_time))); */
-                if (p_ping_static->ping_min_time == 0 || p_ping_static->ping_min_time > cur_time) {
-                    p_ping_static->ping_min_time = cur_time;
+    ping_result.min_time = (int) p_ping_static->ping_min_time;
+    ping_result.max_time = (int) p_ping_static->ping_max_time;
+    ping_result.avg_time = (int) p_ping_static->ping_avg_time;
+    ping_result.total_num = (int) p_ping_static->count;
+    ping_result.recv_num = (int) p_ping_static->ping_recv_num;
+    ping_result.lost_num = (int) p_ping_static->ping_lost_num;
+
+    PING_LOGI("%"U16_F".%"U16_F".%"U16_F".%"U16_F", Packets: Sent = %d, Received =%d, Lost = %d (%d%% loss)",\
+                        ip4_addr1_16(ping_target),         \
+                        ip4_addr2_16(ping_target),         \
+                        ip4_addr3_16(ping_target),         \
+                        ip4_addr4_16(ping_target),         \
+                        (int) ping_result.total_num,         \
+                        (int) ping_result.recv_num,          \
+                        (int) ping_result.lost_num,          \
+                        (int) ((ping_result.lost_num * 100) / ping_result.total_num));
+    PING_LOGI(" Packets: min = %d, max =%d, avg = %d", (int) ping_result.min_time, (int) ping_result.max_time, (int) ping_result.avg_time);
+    if (callback != NULL) {
+        callback(&ping_result);
+    }
+}
+
+#if PING_USE_CORO
+
+/* one ping at a time ( is_ping_ongoing ), a job of the CORO task instead of a task with its own stack */
+typedef struct _ping_job {
+    coro_t co; /* first */
+    int s;
+    ip4_addr_t target;
+    u32_t residual_count;
+    ping_request_result_t callback;
+    ping_static_t st;
+} ping_job_t;
+static ping_job_t ping_job;
+
+static int
+ping_job_run(coro_t *c) {
+    ping_job_t *j = (ping_job_t *) c;
+    char buf[64];
+    struct sockaddr_in from;
+    socklen_t fromlen;
+    int len, r;
+    u32_t waited;
+
+    CORO_BEGIN(c);
+    do {
+        if (ping_send(j->s, &j->target, &j->st) == ERR_OK) {
+            j->st.ping_time = sys_now();
+            for (;;) {
+                waited = sys_now() - j->st.ping_time;
+                CORO_WAIT_READ(c, j->s, (waited < PING_RCV_TIMEO) ? PING_RCV_TIMEO - waited : 0);
+                if (0 == (c->ev & CORO_EV_READ)) {
+                    PING_LOGI("ping: timeout");
+                    j->st.ping_lost_num = j->st.ping_lost_num + 1;
+                    PING_RESULT(0);
+                    break;
+                }
+                r = 0;
+                fromlen = sizeof (from);
+                while (0 == r && (len = lwip_recvfrom(j->s, buf, sizeof (buf), MSG_DONTWAIT, (struct sockaddr*) &from, &fromlen)) > 0) {
+                    r = ping_recv_one(buf, len, &from, &j->target, &j->st);
+                    fromlen = sizeof (from);
                 }
-                if (p_ping_static->ping_max_time == 0 || p_ping_static->ping_max_time < cur_time) {
-                    p_ping_static->ping_max_time = cur_time;
+                if (r != 0) {
+                    break;
                 }
-                p_ping_static->ping_avg_time = p_ping_static->ping_avg_time + cur_time;
+            }
+        } else {
+            LWIP_DEBUGF(PING_DEBUG, ("ping: send "));
+            ip4_addr_debug_print(PING_DEBUG, &j->target);
+            PING_LOGI(" - error");
+        }
 
-                ping_done = 1;
-                p_ping_static->ping_recv_num = p_ping_static->ping_recv_num + 1;
+        CORO_SLEEP(c, PING_DELAY);
 
-                /* do some ping result processing */
-                PING_RESULT((ICMPH_TYPE(iecho) == ICMP_ER));
-                return;
-            } else {
-                /* Treat ping ack received after timeout as success */
-                p_ping_static->ping_recv_num = p_ping_static->ping_recv_num + 1;
-                p_ping_static->ping_lost_num = p_ping_static->ping_lost_num - 1;
-                PING_LOGI("ping: Get ping ACK seq(0x%04X), expected seq(0x%04X)", htons(iecho->seqno), p_ping_static->ping_seq_num);
-                /* Can not return, due to there could be ping ack which has matched sequence num. */
-            }
+        if (0 != (j->st.count)) {
+            j->residual_count--;
+        } else {
+            j->residual_count = 1;
+        }
+    } while (j->residual_count > 0);
+    ping_report(&j->target, &j->st, j->callback);
+    CORO_END(c);
+}
+
+static void
+ping_job_done(coro_t *c) {
+    lwip_close(((ping_job_t *) c)->s);
+    is_ping_ongoing = 0;
+}
+
+static bool
+ping_job_start(ping_arg_t *arg) {
+    ping_job_t *j = &ping_job;
+
+    if (!coro_init(PING_TASK_PRIO)) {
+        return false;
+    }
+    if ((j->s = lwip_socket(AF_INET, SOCK_RAW, IP_PROTO_ICMP)) < 0) {
+        return false;
+    }
+    ip4addr_aton((const char *) (arg->addr), &j->target);
+    memset(&j->st, 0, sizeof (j->st));
+    j->st.size = arg->size;
+    j->st.count = arg->count;
+    j->residual_count = arg->count;
+    j->callback = arg->callback;
+    coro_start(&j->co, ping_job_run, ping_job_done);
+    return true;
+}
+
+#else /* PING_USE_CORO */
+
+static void
+ping_recv(int s, ip4_addr_t *addr, ping_static_t *p_ping_static) {
+    char buf[64];
+    int fromlen, len;
+    struct sockaddr_in from;
 
+    fromlen = sizeof (struct sockaddr_in);
+    while ((len = lwip_recvfrom(s, buf, sizeof (buf), 0, (struct sockaddr*) &from, (socklen_t*) & fromlen)) > 0) {
+        if (ping_recv_one(buf, len, &from, addr, p_ping_static) != 0) {
+            return;
         }
     }
 
@@ -294,13 +425,13 @@ ping_thread(void *arg) {
     u32_t residual_count = (((ping_arg_t *) arg)->count);
     ping_request_result_t callback = ((ping_arg_t *) arg)->callback;
     ping_static_t ping_static = {0};
-    ping_result_t ping_result = {0};
 
     timeout.tv_sec = PING_RCV_TIMEO / 1000; //set recvive timeout = 1(sec)
     timeout.tv_usec = (PING_RCV_TIMEO % 1000)*1000;
 
     if ((s = lwip_socket(AF_INET, SOCK_RAW, IP_PROTO_ICMP)) < 0) {
         is_ping_ongoing = 0;
+        lwip_socket_thread_cleanup();
         vTaskDelete(NULL);
     }
 
@@ -332,33 +463,14 @@ ping_thread(void *arg) {
             residual_count = 1;
         }
     }    while (residual_count > 0);
-    ping_static.ping_avg_time = (int) ((ping_static.ping_avg_time) / ping_static.count);
-
-    ping_result.min_time = (int) ping_static.ping_min_time;
-    ping_result.max_time = (int) ping_static.ping_max_time;
-    ping_result.avg_time = (int) ping_static.ping_avg_time;
-    ping_result.total_num = (int) ping_static.count;
-    ping_result.recv_num = (int) ping_static.ping_recv_num;
-    ping_result.lost_num = (int) ping_static.ping_lost_num;
-
-    PING_LOGI("%"U16_F".%"U16_F".%"U16_F".%"U16_F", Packets: Sent = %d, Received =%d, Lost = %d (%d%% loss)",\
-                        ip4_addr1_16(&ping_target),         \
-                        ip4_addr2_16(&ping_target),         \
-                        ip4_addr3_16(&ping_target),         \
-                        ip4_addr4_16(&ping_target),         \
-                        (int) ping_result.total_num,         \
-                        (int) ping_result.recv_num,          \
-                        (int) ping_result.lost_num,          \
-                        (int) ((ping_result.lost_num * 100) / ping_result.total_num));
-    PING_LOGI(" Packets: min = %d, max =%d, avg = %d", (int) ping_result.min_time, (int) ping_result.max_time, (int) ping_result.avg_time);
-    if (callback != NULL) {
-        callback(&ping_result);
-    }
+    ping_report(&ping_target, &ping_static, callback);
     lwip_close(s);
     is_ping_ongoing = 0;
+    lwip_socket_thread_cleanup();
     vTaskDelete(NULL);
 }
 
+#endif /* PING_USE_CORO */
 #endif //#if PING_USE_SOCKETS
 
 uint32_t get_ping_done() {
@@ -376,7 +488,17 @@ void ping_init(uint32_t count, char *addr, uint8_t addr_len, uint32_t ping_size)
     memset(g_ping_arg.addr, 0x0, sizeof (g_ping_arg.addr));
     memcpy(g_ping_arg.addr, addr, addr_len);
 #if PING_USE_SOCKETS
-    sys_thread_new(PING_TASK_NAME, ping_thread, (void *) (&g_ping_arg), PING_TASK_STACKSIZE / sizeof (portSTACK_TYPE), PING_TASK_PRIO);
+#if PING_USE_CORO
+    if (!ping_job_start(&g_ping_arg)) {
+        PING_LOGI("Ping job start failed.");
+        is_ping_ongoing = 0;
+    }
+#else /* PING_USE_CORO */
+    if (NULL == sys_thread_new(PING_TASK_NAME, ping_thread, (void *) (&g_ping_arg), PING_TASK_STACKSIZE / sizeof (portSTACK_TYPE), PING_TASK_PRIO)) {
+        PING_LOGI("Ping task create failed.");
+        is_ping_ongoing = 0;
+    }
+#endif /* PING_USE_CORO */
 #else /* PING_USE_SOCKETS */
     ping_raw_init();
 #endif /* PING_USE_SOCKETS */
@@ -404,7 +526,17 @@ void ping_request(uint32_t count, char *addr, uint8_t addr_type, uint32_t ping_s
         return;
     }
 #if PING_USE_SOCKETS
-    sys_thread_new(PING_TASK_NAME, ping_thread, (void *) (&g_ping_arg), PING_TASK_STACKSIZE / sizeof (portSTACK_TYPE), PING_TASK_PRIO);
+#if PING_USE_CORO
+    if (!ping_job_start(&g_ping_arg)) {
+        PING_LOGI("Ping job start failed.");
+        is_ping_ongoing = 0;
+    }
+#else /* PING_USE_CORO */
+    if (NULL == sys_thread_new(PING_TASK_NAME, ping_thread, (void *) (&g_ping_arg), PING_TASK_STACKSIZE / sizeof (portSTACK_TYPE), PING_TASK_PRIO)) {
+        PING_LOGI("Ping task create failed.");
+        is_ping_ongoing = 0;
+    }
+#endif /* PING_USE_CORO */
 #else /* PING_USE_SOCKETS */
     ping_raw_init();
 #endif /* PING_USE_SOCKETS */
@@ -32,6 +32,16 @@ typedef struct _ping_result
 #define PING_USE_SOCKETS    LWIP_SOCKET
 #endif
 
+/**
+ * PING_USE_CORO: Set to 1 to run the socket ping as a job of the CORO task ( coro.h ),
+ * otherwise every ping request gets a task of PING_TASK_STACKSIZE
+ * RAM: the job is a static ping_job_t of about 100 bytes, its 64 byte receive buffer is on the
+ * CORO stack only while it runs; a ping task takes PING_TASK_STACKSIZE ( 2 KB ) and a TCB
+ */
+#ifndef PING_USE_CORO
+#define PING_USE_CORO       PING_USE_SOCKETS
+#endif
+
 typedef void (* ping_request_result_t)(ping_result_t *result);
 
 //addr_type:PING_IP_ADDR_V4 or PING_IP_ADDR_V6, current only support PING_IP_ADDR_V4
@@ -207,9 +207,9 @@
 
 
 #ifdef SNTP_DEBUG
-#define LOGE(fmt,arg...)   TRACE("[SNTP]: "fmt"\n",##arg)
-#define LOGW(fmt,arg...)   TRACE("[SNTP]: "fmt"\n",##arg)
-#define LOGI(fmt,arg...)   TRACE("[SNTP]: "fmt"\n",##arg)
+#define LOGE(fmt,arg...)   LOG_BIN("[SNTP]: "fmt"\n",##arg)
+#define LOGW(fmt,arg...)   LOG_BIN("[SNTP]: "fmt"\n",##arg)
+#define LOGI(fmt,arg...)   LOG_BIN("[SNTP]: "fmt"\n",##arg)
 #else
 #define LOGE(x, ...)
 #define LOGW(x, ...)
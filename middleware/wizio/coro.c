@@ -0,0 +1,264 @@
+/*
+ *  Stackless coroutines, see coro.h
+ *  One round: take the started jobs, run every job whose event or deadline came,
+ *  collect the sockets and the nearest deadline of the others, then sleep
+ *  A job is runnable when coro_t.ev is not 0, the loop never blocks inside a job
+ *
+ *  Wakes: the state is in coro_new and coro_t.signaled, the notification only ends the sleep
+ *  A notification taken by a netconn call of a job is not lost, coro_collect() sees the flags after the jobs ran
+ *  coro_in_select is set before coro_collect(), a kick after it also sends the loopback datagram
+ */
+
+#include "sys.h"
+#include "osal.h"
+#include "coro.h"
+#include "lwip/sockets.h"
+#include "lwip/tcpip.h"
+#include "lwip/udp.h"
+
+static coro_t * coro_list;              /* CORO task only */
+static coro_t * coro_new;               /* started, not taken by the loop yet */
+static TaskHandle_t coro_task;
+static int coro_wake_fd = -1;
+static struct sockaddr_in coro_wake_addr;
+static struct tcpip_callback_msg * coro_nudge_msg;
+static struct udp_pcb * coro_nudge_pcb; /* tcpip_thread only */
+static volatile uint32_t coro_in_select;
+static volatile uint32_t coro_wake_pending;
+static coro_stat_t coro_st;
+
+/* tcpip_thread, the datagram that ends the lwip_select() of the loop */
+static void coro_nudge(void * arg) {
+    ip_addr_t ip;
+    struct pbuf * p;
+    if (NULL == coro_nudge_pcb)
+        coro_nudge_pcb = udp_new();
+    p = coro_nudge_pcb ? pbuf_alloc(PBUF_TRANSPORT, 1, PBUF_RAM) : NULL;
+    if (NULL == p) {
+        coro_st.nudge_fails++;
+        coro_wake_pending = 0; // CORO_POLL_MS ends the select
+        return;
+    }
+    IP_ADDR4(&ip, 127, 0, 0, 1);
+    if (ERR_OK != udp_sendto(coro_nudge_pcb, p, &ip, lwip_ntohs(coro_wake_addr.sin_port))) {
+        coro_st.nudge_fails++;
+        coro_wake_pending = 0;
+    }
+    pbuf_free(p);
+    (void) arg;
+}
+
+/* never blocks, one datagram per select at most, the loop clears coro_wake_pending after draining */
+static void coro_kick(void) {
+    if (NULL == coro_task || xTaskGetCurrentTaskHandle() == coro_task)
+        return; // the loop looks at the flags before it sleeps
+    xTaskNotify(coro_task, CORO_NOTIFY_BIT, eSetBits);
+    __sync_synchronize();
+    if (coro_in_select && coro_nudge_msg && 0 == __sync_lock_test_and_set(&coro_wake_pending, 1)) {
+        coro_st.nudges++;
+        if (ERR_OK != tcpip_trycallback(coro_nudge_msg)) {
+            coro_st.nudge_fails++;
+            coro_wake_pending = 0;
+        }
+    }
+}
+
+void coro_wait(coro_t * c, uint8_t what, uint32_t ms, int fd) {
+    TickType_t ticks;
+    c->wait = what;
+    c->fd = fd;
+    if (CORO_FOREVER != ms) {
+        ticks = pdMS_TO_TICKS(ms);
+        c->wait |= CORO_EV_TIMEOUT;
+        c->deadline = xTaskGetTickCount() + (ticks ? ticks : 1); // a yield lets the loop sleep a tick
+    }
+}
+
+void coro_start(coro_t * c, coro_fn_t fn, void (* done)(coro_t * c)) {
+    c->fn = fn;
+    c->done = done;
+    c->lc = 0;
+    c->ev = 0;
+    c->signaled = 0;
+    c->fd = -1;
+    c->wait = CORO_EV_TIMEOUT;
+    c->deadline = xTaskGetTickCount(); // runs in the next round
+    taskENTER_CRITICAL();
+    c->next = coro_new;
+    coro_new = c;
+    taskEXIT_CRITICAL();
+    coro_kick();
+}
+
+void coro_signal(coro_t * c) {
+    c->signaled = 1;
+    __sync_synchronize();
+    coro_kick();
+}
+
+void coro_timer_cb(TimerHandle_t t) {
+    coro_signal((coro_t *) pvTimerGetTimerID(t));
+}
+
+static bool coro_wake_open(void) {
+    socklen_t len = sizeof (coro_wake_addr);
+    memset(&coro_wake_addr, 0, sizeof (coro_wake_addr));
+    coro_wake_addr.sin_family = AF_INET;
+    coro_wake_addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+    if (NULL == (coro_nudge_msg = tcpip_callbackmsg_new(coro_nudge, NULL)))
+        return false;
+    if ((coro_wake_fd = lwip_socket(AF_INET, SOCK_DGRAM, 0)) >= 0) {
+        if (0 == lwip_bind(coro_wake_fd, (struct sockaddr *) &coro_wake_addr, sizeof (coro_wake_addr)) &&
+                0 == lwip_getsockname(coro_wake_fd, (struct sockaddr *) &coro_wake_addr, &len))
+            return true;
+        lwip_close(coro_wake_fd);
+        coro_wake_fd = -1;
+    }
+    tcpip_callbackmsg_delete(coro_nudge_msg);
+    coro_nudge_msg = NULL;
+    return false;
+}
+
+/* runs the jobs with an event, rd and wr are the result of the last select */
+static void coro_run(fd_set * rd, fd_set * wr, TickType_t now) {
+    coro_t * c, ** pc = &coro_list;
+    while ((c = *pc)) {
+        c->ev = 0;
+        if ((c->wait & CORO_EV_SIGNAL) && c->signaled) {
+            c->signaled = 0;
+            c->ev |= CORO_EV_SIGNAL;
+        }
+        if ((c->wait & CORO_EV_READ) && FD_ISSET(c->fd, rd))
+            c->ev |= CORO_EV_READ;
+        if ((c->wait & CORO_EV_WRITE) && FD_ISSET(c->fd, wr))
+            c->ev |= CORO_EV_WRITE;
+        if (0 == c->ev && (c->wait & CORO_EV_TIMEOUT) && (int32_t) (now - c->deadline) >= 0)
+            c->ev = CORO_EV_TIMEOUT;
+        if (c->ev && CORO_DONE == c->fn(c)) {
+            *pc = c->next;
+            coro_st.jobs--;
+            if (c->done)
+                c->done(c);
+            continue;
+        }
+        pc = &c->next;
+    }
+}
+
+/* sockets of the jobs into rd and wr ( maxfd -1 for none ), ticks to the nearest deadline */
+static TickType_t coro_collect(fd_set * rd, fd_set * wr, int * maxfd, TickType_t now) {
+    TickType_t wait = portMAX_DELAY;
+    int32_t left;
+    coro_t * c;
+    FD_ZERO(rd);
+    FD_ZERO(wr);
+    *maxfd = -1;
+    for (c = coro_list; c; c = c->next) {
+        if (c->wait & (CORO_EV_READ | CORO_EV_WRITE)) {
+            if (c->wait & CORO_EV_READ)
+                FD_SET(c->fd, rd);
+            if (c->wait & CORO_EV_WRITE)
+                FD_SET(c->fd, wr);
+            if (c->fd > *maxfd)
+                *maxfd = c->fd;
+        }
+        if ((c->wait & CORO_EV_SIGNAL) && c->signaled)
+            wait = 0;
+        if (c->wait & CORO_EV_TIMEOUT) {
+            left = (int32_t) (c->deadline - now);
+            if (left <= 0)
+                wait = 0;
+            else if ((TickType_t) left < wait)
+                wait = left;
+        }
+    }
+    if (coro_new)
+        wait = 0;
+    return wait;
+}
+
+/* the jobs wait for sockets, the wake socket ends the select on a kick */
+static void coro_select(fd_set * rd, fd_set * wr, int maxfd, TickType_t wait) {
+    struct timeval tv;
+    char b[4];
+    int n;
+    if (wait > pdMS_TO_TICKS(CORO_POLL_MS))
+        wait = pdMS_TO_TICKS(CORO_POLL_MS);
+    if (coro_wake_fd >= 0) {
+        FD_SET(coro_wake_fd, rd);
+        if (coro_wake_fd > maxfd)
+            maxfd = coro_wake_fd;
+    }
+    tv.tv_sec = (wait * portTICK_PERIOD_MS) / 1000;
+    tv.tv_usec = ((wait * portTICK_PERIOD_MS) % 1000) * 1000;
+    n = lwip_select(maxfd + 1, rd, wr, NULL, &tv);
+    if (n <= 0) {
+        FD_ZERO(rd);
+        FD_ZERO(wr);
+    } else if (coro_wake_fd >= 0 && FD_ISSET(coro_wake_fd, rd)) {
+        coro_st.wakes++;
+        while (lwip_recv(coro_wake_fd, b, sizeof (b), MSG_DONTWAIT) > 0);
+        __sync_synchronize();
+        coro_wake_pending = 0; // a kick from now on sends again
+    }
+}
+
+static void entryCORO(void * arg) {
+    fd_set rd, wr;
+    TickType_t wait;
+    coro_t * c;
+    int maxfd;
+    if (!coro_wake_open())
+        LOG("[CORO] no wake socket, jobs on sockets see signals after CORO_POLL_MS\n");
+    FD_ZERO(&rd);
+    FD_ZERO(&wr);
+    for (;;) {
+        taskENTER_CRITICAL();
+        c = coro_new;
+        coro_new = NULL;
+        taskEXIT_CRITICAL();
+        while (c) {
+            coro_t * next = c->next;
+            c->next = coro_list;
+            coro_list = c;
+            if (++coro_st.jobs > coro_st.peak)
+                coro_st.peak = coro_st.jobs;
+            c = next;
+        }
+        coro_st.rounds++;
+        coro_run(&rd, &wr, xTaskGetTickCount());
+        coro_in_select = 1;
+        __sync_synchronize();
+        wait = coro_collect(&rd, &wr, &maxfd, xTaskGetTickCount());
+        if (maxfd >= 0) {
+            coro_select(&rd, &wr, maxfd, wait);
+            coro_in_select = 0;
+        } else {
+            coro_in_select = 0;
+            if (wait)
+                xTaskNotifyWait(0, CORO_NOTIFY_BIT, NULL, wait);
+        }
+    }
+    (void) arg;
+}
+
+bool coro_init(UBaseType_t prio) {
+    if (coro_task)
+        return true;
+    return pdPASS == rtos_task_create(entryCORO, "CORO", CORO_STACK_WORDS, NULL, prio, &coro_task);
+}
+
+void coro_stat(coro_stat_t * st) {
+    *st = coro_st;
+    st->stack_free = coro_task ? uxTaskGetStackHighWaterMark(coro_task) : 0;
+}
+
+void coro_dump(uint32_t job_bytes, uint32_t task_words) {
+    coro_stat_t st;
+    uint32_t tcb = sizeof (StaticTask_t);
+    coro_stat(&st);
+    LOG("[CORO] jobs %u peak %u, rounds %u wakes %u nudges %u fail %u, stack used %u/%u words\n",
+            st.jobs, st.peak, st.rounds, st.wakes, st.nudges, st.nudge_fails, CORO_STACK_WORDS - st.stack_free, CORO_STACK_WORDS);
+    LOG("[CORO] RAM one task %u bytes, one task per job of %u words %u bytes\n",
+            CORO_STACK_WORDS * 4 + tcb + st.peak * job_bytes, task_words, st.peak * (task_words * 4 + tcb));
+}
@@ -0,0 +1,95 @@
+/*
+ *  Stackless coroutines ( protothreads ), many I/O bound jobs in one task
+ *  A job is a function re-entered from its last wait point by a switch on coro_t.lc,
+ *  locals do not survive a wait: keep them in a struct that starts with the coro_t
+ *  No switch() of your own around a wait point in the job body
+ *
+ *  The CORO task runs the ready jobs, then sleeps up to the nearest deadline: on its task
+ *  notification when no job waits for a socket, in lwip_select() ( at most CORO_POLL_MS ) when one does
+ *  coro_start() and coro_signal() work from any task and from a FreeRTOS timer ( coro_timer_cb ), not from an ISR
+ *  They never block: a task notification, and while the loop is in lwip_select() a loopback datagram
+ *  sent by tcpip_thread from a message posted with tcpip_trycallback()
+ *  CORO_YIELD and CORO_WAIT_UNTIL come back after one tick, not in the same round
+ */
+
+#ifndef CORO_H
+#define	CORO_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#define CORO_STACK_WORDS    512     /* the one task of all jobs */
+#define CORO_POLL_MS        500     /* longest lwip_select(), bounds a wake lost to a full tcpip mbox */
+#define CORO_NOTIFY_BIT     (1u << 3) /* mpsc.h bit 0, sys_arch.h bit 1, nsem.h bit 2 */
+#define CORO_FOREVER        0xFFFFFFFFu
+
+/* job return, the macros below do it */
+#define CORO_WAITING        0
+#define CORO_DONE           1
+
+/* what woke the job, coro_t.ev */
+#define CORO_EV_READ        0x01
+#define CORO_EV_WRITE       0x02
+#define CORO_EV_SIGNAL      0x04
+#define CORO_EV_TIMEOUT     0x08
+
+typedef struct coro coro_t;
+typedef int (* coro_fn_t)(coro_t * c);
+
+struct coro {
+    coro_t * next;
+    coro_fn_t fn;
+    uint16_t lc;                    /* resume point, 0 at start */
+    uint8_t wait;                   /* CORO_EV_* waited for */
+    uint8_t ev;                     /* CORO_EV_* seen at resume */
+    volatile uint8_t signaled;
+    int fd;                         /* socket of CORO_WAIT_READ / CORO_WAIT_WRITE */
+    TickType_t deadline;
+    void (* done)(coro_t * c);      /* after CORO_END, may free the job */
+};
+
+#define CORO_BEGIN(c)           switch ((c)->lc) { case 0:
+#define CORO_END(c)             } (c)->lc = 0; return CORO_DONE
+
+/* wait point, the job is left and re-entered at the case label */
+#define CORO_WAIT_(c, what, ms, fd_)                                \
+    do {                                                            \
+        coro_wait((c), (what), (ms), (fd_));                        \
+        (c)->lc = __LINE__; return CORO_WAITING; case __LINE__:;    \
+    } while (0)
+
+#define CORO_YIELD(c)               CORO_WAIT_(c, 0, 0, -1)
+#define CORO_SLEEP(c, ms)           CORO_WAIT_(c, 0, ms, -1)
+#define CORO_WAIT_SIGNAL(c, ms)     CORO_WAIT_(c, CORO_EV_SIGNAL, ms, -1)
+#define CORO_WAIT_READ(c, s, ms)    CORO_WAIT_(c, CORO_EV_READ, ms, s)
+#define CORO_WAIT_WRITE(c, s, ms)   CORO_WAIT_(c, CORO_EV_WRITE, ms, s)
+#define CORO_WAIT_UNTIL(c, cond)    do { (c)->lc = __LINE__; case __LINE__: if (!(cond)) { coro_wait((c), 0, 0, -1); return CORO_WAITING; } } while (0)
+#define CORO_EXIT(c)                do { (c)->lc = 0; return CORO_DONE; } while (0)
+
+bool coro_init(UBaseType_t prio);
+void coro_start(coro_t * c, coro_fn_t fn, void (* done)(coro_t * c));
+void coro_signal(coro_t * c);
+void coro_timer_cb(TimerHandle_t t); /* xTimerCreate(..., coro as the timer ID, coro_timer_cb) */
+void coro_wait(coro_t * c, uint8_t what, uint32_t ms, int fd); /* used by the macros */
+
+typedef struct {
+    uint32_t jobs, peak, rounds, wakes;
+    uint32_t nudges, nudge_fails;   /* loopback wakes of lwip_select() */
+    uint32_t stack_free;            /* words, high-water of the CORO task */
+} coro_stat_t;
+
+void coro_stat(coro_stat_t * st);
+void coro_dump(uint32_t job_bytes, uint32_t task_words); /* RAM of the jobs against one task per job */
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CORO_H */
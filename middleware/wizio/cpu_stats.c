@@ -0,0 +1,121 @@
+/*
+ *  Per task CPU time, see cpu_stats.h
+ *  the slot of a task is kept in its uxTaskNumber, the hooks run with the kernel critical section held
+ */
+
+#include "sys.h"
+#include "osal.h"
+#include "cpu_stats.h"
+
+#if configUSE_CPU_STATS
+
+typedef struct {
+    uint64_t ticks;
+    uint64_t prev;      /* at the previous snapshot */
+} cpu_slot_t;
+
+static cpu_slot_t cpu_slot[CPU_STATS_TASKS];
+static uint32_t cpu_slot_map = 1; /* slot 0 is never given out */
+static uint32_t cpu_current;
+static uint32_t cpu_last;
+static uint32_t cpu_isr_depth;
+static uint64_t cpu_isr, cpu_isr_prev;
+static uint64_t cpu_total, cpu_total_prev;
+
+static inline void cpu_charge(uint64_t * bucket) {
+    uint32_t now = CPU_STATS_CLOCK();
+    uint32_t delta = now - cpu_last;
+    cpu_last = now;
+    *bucket += delta;
+    cpu_total += delta;
+}
+
+/* traceTASK_CREATE */
+unsigned long cpu_stats_task_create(void) {
+    unsigned long slot = 0;
+    if (~cpu_slot_map & ((1ull << CPU_STATS_TASKS) - 1)) {
+        slot = __builtin_ctz(~cpu_slot_map);
+        cpu_slot_map |= 1u << slot;
+        cpu_slot[slot].ticks = cpu_slot[slot].prev = 0;
+    }
+    return slot;
+}
+
+/* traceTASK_DELETE */
+void cpu_stats_task_delete(unsigned long slot) {
+    if (slot && slot < CPU_STATS_TASKS)
+        cpu_slot_map &= ~(1u << slot);
+}
+
+/* traceTASK_SWITCHED_IN */
+void cpu_stats_switch(unsigned long slot) {
+    if (0 == cpu_isr_depth)
+        cpu_charge(&cpu_slot[cpu_current].ticks);
+    cpu_current = (slot < CPU_STATS_TASKS) ? slot : 0;
+}
+
+/* traceISR_ENTER, nested interrupts count once */
+void cpu_stats_isr_enter(void) {
+    if (0 == cpu_isr_depth++)
+        cpu_charge(&cpu_slot[cpu_current].ticks);
+}
+
+/* traceISR_EXIT */
+void cpu_stats_isr_exit(void) {
+    if (0 == --cpu_isr_depth)
+        cpu_charge(&cpu_isr);
+}
+
+static inline uint32_t cpu_permille(uint64_t part, uint64_t total) {
+    return total ? (uint32_t) (part * 1000 / total) : 0;
+}
+
+void cpu_stats_snapshot(cpu_stats_snapshot_t * s) {
+    static TaskStatus_t status[CPU_STATS_TASKS];
+    static uint64_t ticks[CPU_STATS_TASKS];
+    uint64_t isr;
+    uint32_t i, n, slot;
+    n = uxTaskGetSystemState(status, CPU_STATS_TASKS, NULL);
+    taskENTER_CRITICAL();
+    cpu_charge(&cpu_slot[cpu_current].ticks);
+    for (i = 0; i < CPU_STATS_TASKS; i++) {
+        ticks[i] = cpu_slot[i].ticks - cpu_slot[i].prev;
+        cpu_slot[i].prev = cpu_slot[i].ticks;
+    }
+    s->elapsed = cpu_total - cpu_total_prev;
+    cpu_total_prev = cpu_total;
+    isr = cpu_isr - cpu_isr_prev;
+    cpu_isr_prev = s->isr = cpu_isr;
+    taskEXIT_CRITICAL();
+    s->isr_permille = cpu_permille(isr, s->elapsed);
+    for (i = 0; i < n; i++) {
+        slot = uxTaskGetTaskNumber(status[i].xHandle);
+        if (slot >= CPU_STATS_TASKS)
+            slot = 0;
+        s->task[i].name = status[i].pcTaskName;
+        s->task[i].number = status[i].xTaskNumber;
+        s->task[i].ticks = cpu_slot[slot].ticks;
+        s->task[i].permille = cpu_permille(ticks[slot], s->elapsed);
+    }
+    s->count = n;
+}
+
+/* one line, tasks under 0.1% are left out */
+void cpu_stats_dump(void) {
+    static cpu_stats_snapshot_t s;
+    char line[192];
+    int len;
+    uint32_t i;
+    cpu_stats_snapshot(&s);
+    len = snprintf(line, sizeof (line), "[CPU] %u ms:", (uint32_t) (s.elapsed / (CPU_STATS_HZ / 1000)));
+    for (i = 0; i < s.count && len < (int) sizeof (line); i++) {
+        if (s.task[i].permille)
+            len += snprintf(line + len, sizeof (line) - len, " %s %u.%u%%",
+                s.task[i].name, s.task[i].permille / 10, s.task[i].permille % 10);
+    }
+    if (len < (int) sizeof (line))
+        snprintf(line + len, sizeof (line) - len, " ISR %u.%u%%", s.isr_permille / 10, s.isr_permille % 10);
+    LOG("%s\n", line);
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ *  Per task CPU time on the core timer, configUSE_CPU_STATS in FreeRTOSConfig.h
+ *  Every task switch and every ISR entry/exit (traceISR_ENTER/EXIT) charges the time since the
+ *  previous event to the running task or to the ISR bucket, counters are 64 bit core timer ticks
+ *  The kernel own run time counters are 32 bit and wrap after 43 s at 100 MHz, so they stay off
+ */
+
+#ifndef CPU_STATS_H
+#define	CPU_STATS_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+
+#define CPU_STATS_TASKS     16  /* slot 0 gets the time before the scheduler and of tasks over the limit */
+#define CPU_STATS_HZ        (configCPU_CLOCK_HZ / 2)
+
+#ifdef __XC32
+#define CPU_STATS_CLOCK()   _CP0_GET_COUNT()
+#else
+/* host or simulator build, the same tick rate from the monotonic clock */
+#include <time.h>
+static inline uint32_t cpu_stats_clock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t) ((uint64_t) ts.tv_sec * CPU_STATS_HZ + (uint64_t) ts.tv_nsec * CPU_STATS_HZ / 1000000000ull);
+}
+#define CPU_STATS_CLOCK()   cpu_stats_clock()
+#endif
+
+typedef struct {
+    const char * name;
+    uint32_t number;    /* xTaskNumber */
+    uint64_t ticks;     /* since the task was created */
+    uint32_t permille;  /* since the previous snapshot */
+} cpu_stats_task_t;
+
+typedef struct {
+    uint64_t elapsed;   /* ticks since the previous snapshot */
+    uint64_t isr;       /* ISR ticks since boot */
+    uint32_t isr_permille;
+    uint32_t count;
+    cpu_stats_task_t task[CPU_STATS_TASKS];
+} cpu_stats_snapshot_t;
+
+#if configUSE_CPU_STATS
+
+/* each call measures from the previous one */
+void cpu_stats_snapshot(cpu_stats_snapshot_t * s);
+void cpu_stats_dump(void);
+
+#else
+
+static inline void cpu_stats_snapshot(cpu_stats_snapshot_t * s) { s->count = 0; }
+static inline void cpu_stats_dump(void) {}
+
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CPU_STATS_H */
@@ -14,6 +14,7 @@ BaseType_t xQueueGenericReceive(QueueHandle_t xQueue, void * const pvBuffer, Tic
 void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName) {
     portDISABLE_INTERRUPTS();
     LOG("\n[ASSERT] Stack overflow: 0x%x %s\n", (unsigned int) xTask, (portCHAR *) pcTaskName);
+    sys_log_flush();
     LED_RED_ON();
     while (1);
 }
@@ -21,6 +22,7 @@ void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName) {
 void vAssertCalled( const char * const pcFileName, unsigned long ulLine) {
     portDISABLE_INTERRUPTS();
     LOG("\n[ASSERT] Called: %s, Line: %u\n", pcFileName, ulLine);
+    sys_log_flush();
     LED_RED_ON();
     while (1);
 }
\ No newline at end of file
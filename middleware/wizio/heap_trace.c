@@ -0,0 +1,224 @@
+/*
+ *  Heap accounting per task and per call site
+ *  heap_trace_malloc/free/realloc run from the traceMALLOC/traceFREE/traceREALLOC hooks
+ *  of heap_4.c with the scheduler suspended, sizes include the heap block header
+ */
+
+#include <string.h>
+#include "sys.h"
+#include "osal.h"
+#include "heap_trace.h"
+
+#if configUSE_HEAP_TRACE
+
+#define HT_NONE     0xFF
+#define HT_MASK     (HEAP_TRACE_LIVE - 1)
+#define HT_HASH(P)  (((uint32_t) (P) >> 3) & HT_MASK)
+
+typedef struct {
+    void * ptr;
+    uint32_t size;
+    uint8_t site;
+    uint8_t task;
+} ht_live_t;
+
+typedef struct {
+    void * caller;
+    uint32_t live, peak, count, fail;
+} ht_site_t;
+
+typedef struct {
+    TaskHandle_t handle;
+    void * caller; // set by heap_trace_caller(), taken by the next malloc/free
+    uint32_t live, peak, count;
+    uint32_t depth, base[HEAP_TRACE_DEPTH], top[HEAP_TRACE_DEPTH];
+    char name[configMAX_TASK_NAME_LEN];
+} ht_task_t;
+
+static ht_live_t ht_live[HEAP_TRACE_LIVE];
+static ht_site_t ht_sites[HEAP_TRACE_SITES];
+static ht_task_t ht_tasks[HEAP_TRACE_TASKS];
+static uint32_t ht_site_count, ht_task_count;
+static uint32_t ht_total, ht_peak, ht_lost;
+
+static ht_task_t * ht_task(void) {
+    TaskHandle_t handle = xTaskGetCurrentTaskHandle();
+    const char * name = handle ? pcTaskGetName(handle) : "BOOT";
+    ht_task_t * t;
+    uint32_t i;
+    for (i = 0; i < ht_task_count; i++) {
+        t = &ht_tasks[i];
+        /* a new task may get the TCB of a deleted one */
+        if (t->handle == handle && 0 == strncmp(t->name, name, configMAX_TASK_NAME_LEN))
+            return t;
+    }
+    if (ht_task_count == HEAP_TRACE_TASKS)
+        return NULL;
+    t = &ht_tasks[ht_task_count++];
+    t->handle = handle;
+    strncpy(t->name, name, configMAX_TASK_NAME_LEN - 1);
+    return t;
+}
+
+static uint8_t ht_site(void * caller) {
+    uint32_t i;
+    for (i = 0; i < ht_site_count; i++)
+        if (ht_sites[i].caller == caller)
+            return i;
+    if (ht_site_count == HEAP_TRACE_SITES)
+        return HT_NONE;
+    ht_sites[ht_site_count].caller = caller;
+    return ht_site_count++;
+}
+
+static ht_live_t * ht_find(void * ptr) {
+    uint32_t i = HT_HASH(ptr), n;
+    for (n = 0; n < HEAP_TRACE_LIVE && ht_live[i].ptr; n++, i = (i + 1) & HT_MASK)
+        if (ht_live[i].ptr == ptr)
+            return &ht_live[i];
+    return NULL;
+}
+
+/* linear probing, backward shift delete - no tombstones */
+static void ht_remove(ht_live_t * e) {
+    uint32_t i = e - ht_live, j = i, k;
+    while (1) {
+        j = (j + 1) & HT_MASK;
+        if (NULL == ht_live[j].ptr)
+            break;
+        k = HT_HASH(ht_live[j].ptr);
+        if ((i < j) ? (i < k && k <= j) : (i < k || k <= j))
+            continue;
+        ht_live[i] = ht_live[j];
+        i = j;
+    }
+    ht_live[i].ptr = NULL;
+}
+
+static void ht_account(ht_live_t * e, int32_t delta) {
+    uint32_t d;
+    ht_total += delta;
+    if (ht_total > ht_peak)
+        ht_peak = ht_total;
+    if (e->site != HT_NONE) {
+        ht_site_t * s = &ht_sites[e->site];
+        s->live += delta;
+        if (s->live > s->peak)
+            s->peak = s->live;
+    }
+    if (e->task != HT_NONE) {
+        ht_task_t * t = &ht_tasks[e->task];
+        t->live += delta;
+        if (t->live > t->peak)
+            t->peak = t->live;
+        for (d = 0; d < t->depth && d < HEAP_TRACE_DEPTH; d++)
+            if (t->live > t->top[d])
+                t->top[d] = t->live;
+    }
+}
+
+static void * ht_take_caller(ht_task_t * t, void * caller) {
+    if (t && t->caller) {
+        caller = t->caller;
+        t->caller = NULL;
+    }
+    return caller;
+}
+
+void heap_trace_malloc(void * pv, size_t size, void * caller) {
+    ht_task_t * t = ht_task();
+    uint8_t site = ht_site(ht_take_caller(t, caller));
+    uint32_t i, n;
+    if (NULL == pv) {
+        if (site != HT_NONE)
+            ht_sites[site].fail++;
+        return;
+    }
+    for (i = HT_HASH(pv), n = 0; n < HEAP_TRACE_LIVE && ht_live[i].ptr; n++)
+        i = (i + 1) & HT_MASK;
+    if (n == HEAP_TRACE_LIVE) {
+        ht_lost++;
+        return;
+    }
+    ht_live[i].ptr = pv;
+    ht_live[i].size = size;
+    ht_live[i].site = site;
+    ht_live[i].task = t ? t - ht_tasks : HT_NONE;
+    if (site != HT_NONE)
+        ht_sites[site].count++;
+    if (t)
+        t->count++;
+    ht_account(&ht_live[i], size);
+}
+
+void heap_trace_free(void * pv, size_t size) {
+    ht_live_t * e;
+    ht_take_caller(ht_task(), NULL);
+    if ((e = ht_find(pv))) {
+        ht_account(e, -(int32_t) e->size);
+        ht_remove(e);
+    }
+    (void) size;
+}
+
+/* resized in place, the block keeps its owner and call site */
+void heap_trace_realloc(void * pv, size_t old_size, size_t new_size, void * caller) {
+    ht_live_t * e;
+    ht_take_caller(ht_task(), caller);
+    if ((e = ht_find(pv))) {
+        ht_account(e, (int32_t) new_size - (int32_t) e->size);
+        e->size = new_size;
+    }
+    (void) old_size;
+}
+
+void heap_trace_caller(void * caller) {
+    ht_task_t * t;
+    vTaskSuspendAll();
+    t = ht_task();
+    if (t && NULL == t->caller) // outermost wrapper wins
+        t->caller = caller;
+    (void) xTaskResumeAll();
+}
+
+void heap_trace_begin(void) {
+    ht_task_t * t;
+    vTaskSuspendAll();
+    if ((t = ht_task())) {
+        if (t->depth < HEAP_TRACE_DEPTH)
+            t->base[t->depth] = t->top[t->depth] = t->live;
+        t->depth++;
+    }
+    (void) xTaskResumeAll();
+}
+
+uint32_t heap_trace_end(void) {
+    ht_task_t * t;
+    uint32_t peak = 0;
+    vTaskSuspendAll();
+    if ((t = ht_task()) && t->depth) {
+        t->depth--;
+        if (t->depth < HEAP_TRACE_DEPTH)
+            peak = t->top[t->depth] - t->base[t->depth];
+    }
+    (void) xTaskResumeAll();
+    return peak;
+}
+
+/* counters are read without locking, the report is a snapshot for humans */
+void heap_trace_dump(void) {
+    uint32_t i;
+    LOG("[HEAP] live %u peak %u free %u min %u lost %u\n",
+            ht_total, ht_peak, xPortGetFreeHeapSize(), xPortGetMinimumEverFreeHeapSize(), ht_lost);
+    for (i = 0; i < ht_task_count; i++) {
+        ht_task_t * t = &ht_tasks[i];
+        LOG("[HEAP] task %-16s live %6u peak %6u count %u\n", t->name, t->live, t->peak, t->count);
+    }
+    for (i = 0; i < ht_site_count; i++) {
+        ht_site_t * s = &ht_sites[i];
+        LOG("[HEAP] site 0x%08X live %6u peak %6u count %u fail %u\n",
+                (unsigned) s->caller, s->live, s->peak, s->count, s->fail);
+    }
+}
+
+#endif
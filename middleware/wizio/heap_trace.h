@@ -0,0 +1,47 @@
+/*
+ *  Heap accounting per task and per call site, configUSE_HEAP_TRACE in FreeRTOSConfig.h
+ *  Call sites are return addresses, resolve them with xc32-addr2line -f -e <elf>
+ */
+
+#ifndef HEAP_TRACE_H
+#define	HEAP_TRACE_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+
+#define HEAP_TRACE_LIVE     1024 /* live allocations, power of 2 */
+#define HEAP_TRACE_SITES    64
+#define HEAP_TRACE_TASKS    16
+#define HEAP_TRACE_DEPTH    2    /* nested begin/end windows per task */
+
+#if configUSE_HEAP_TRACE
+
+/* the next allocation of this task belongs to 'caller', used by the malloc wrappers */
+void heap_trace_caller(void * caller);
+#define HEAP_TRACE_CALLER() heap_trace_caller(__builtin_return_address(0))
+
+/* peak of the task own live bytes between begin and end, returned by end */
+void heap_trace_begin(void);
+uint32_t heap_trace_end(void);
+
+void heap_trace_dump(void);
+
+#else
+
+#define HEAP_TRACE_CALLER()
+
+static inline void heap_trace_begin(void) {}
+static inline uint32_t heap_trace_end(void) { return 0; }
+static inline void heap_trace_dump(void) {}
+
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* HEAP_TRACE_H */
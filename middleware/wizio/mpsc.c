@@ -0,0 +1,111 @@
+/*
+ *  Lock-free MPSC mailbox, see mpsc.h
+ *  A cell is free for position pos when seq == pos and holds a message when seq == pos + 1,
+ *  the consumer gives it back for the next lap with seq = pos + size
+ *  mpsc_fetch() stores waiter before its last look at the cells and mpsc_push() reads waiter
+ *  after publishing, with a full barrier on both sides one of them always sees the other
+ */
+
+#include "mpsc.h"
+
+void mpsc_init(mpsc_t * q, uint32_t size) {
+    uint32_t i, n = 1;
+    while (n < size && n < MPSC_MAX)
+        n <<= 1;
+    q->head = q->tail = 0;
+    q->mask = n - 1;
+    q->waiter = NULL;
+    q->full = 0;
+    for (i = 0; i < n; i++)
+        q->cell[i].seq = i;
+}
+
+bool mpsc_push(mpsc_t * q, void * msg) {
+    mpsc_cell_t * c;
+    TaskHandle_t waiter;
+    uint32_t pos = q->head;
+    int32_t dif;
+    for (;;) {
+        c = &q->cell[pos & q->mask];
+        dif = (int32_t) (c->seq - pos);
+        if (0 == dif) {
+            if (__sync_bool_compare_and_swap(&q->head, pos, pos + 1))
+                break;
+        } else if (dif < 0) {
+            q->full++;
+            return false;
+        }
+        pos = q->head; // another producer took it
+    }
+    c->msg = msg;
+    __sync_synchronize();
+    c->seq = pos + 1;
+    __sync_synchronize();
+    if ((waiter = q->waiter))
+        xTaskNotify(waiter, MPSC_NOTIFY_BIT, eSetBits);
+    return true;
+}
+
+bool mpsc_pop(mpsc_t * q, void ** msg) {
+    mpsc_cell_t * c = &q->cell[q->tail & q->mask];
+    if ((int32_t) (c->seq - (q->tail + 1)) < 0)
+        return false; // empty, or the producer has not published yet
+    __sync_synchronize();
+    *msg = c->msg;
+    __sync_synchronize();
+    c->seq = q->tail + q->mask + 1;
+    q->tail++;
+    return true;
+}
+
+/* consumer, a message is published at tail */
+static inline bool mpsc_ready(mpsc_t * q) {
+    return (int32_t) (q->cell[q->tail & q->mask].seq - (q->tail + 1)) >= 0;
+}
+
+bool mpsc_fetch(mpsc_t * q, void ** msg, TickType_t ticks) {
+    TimeOut_t timeout;
+    if (mpsc_pop(q, msg))
+        return true;
+    vTaskSetTimeOutState(&timeout);
+    for (;;) {
+        q->waiter = xTaskGetCurrentTaskHandle();
+        __sync_synchronize();
+        if (mpsc_pop(q, msg))
+            break;
+        if (xTaskCheckForTimeOut(&timeout, &ticks)) {
+            q->waiter = NULL;
+            return false;
+        }
+        xTaskNotifyWait(0, MPSC_NOTIFY_BIT, NULL, ticks);
+    }
+    q->waiter = NULL;
+    return true;
+}
+
+bool mpsc_wait2(mpsc_t * a, mpsc_t * b, TickType_t ticks) {
+    TimeOut_t timeout;
+    TaskHandle_t self;
+    bool ready;
+    if (mpsc_ready(a) || mpsc_ready(b))
+        return true;
+    self = xTaskGetCurrentTaskHandle();
+    vTaskSetTimeOutState(&timeout);
+    for (;;) {
+        a->waiter = self;
+        b->waiter = self;
+        __sync_synchronize();
+        if ((ready = mpsc_ready(a) || mpsc_ready(b)))
+            break;
+        if (xTaskCheckForTimeOut(&timeout, &ticks))
+            break;
+        xTaskNotifyWait(0, MPSC_NOTIFY_BIT, NULL, ticks);
+    }
+    a->waiter = NULL;
+    b->waiter = NULL;
+    return ready;
+}
+
+uint32_t mpsc_count(mpsc_t * q) {
+    return q->head - q->tail;
+}
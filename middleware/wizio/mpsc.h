@@ -0,0 +1,48 @@
+/*
+ *  Lock-free multi producer, single consumer mailbox of pointers, the lwIP sys_mbox with SYS_MBOX_MPSC
+ *  Producers take a cell with compare-and-swap (ll/sc) and publish it with its sequence number,
+ *  the consumer sleeps on a task notification bit and is woken only when it is waiting
+ *  Only one task may fetch from a mailbox at a time, one task may sleep on two mailboxes ( mpsc_wait2 )
+ */
+
+#ifndef MPSC_H
+#define	MPSC_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define MPSC_MAX            16          /* cells, >= the *_MBOX_SIZE in lwipopts.h */
+#define MPSC_NOTIFY_BIT     (1u << 0)   /* task notification bit of the consumer */
+
+typedef struct {
+    volatile uint32_t seq;
+    void * msg;
+} mpsc_cell_t;
+
+typedef struct {
+    volatile uint32_t head;             /* next cell for the producers */
+    uint32_t tail;                      /* next cell for the consumer */
+    uint32_t mask;
+    TaskHandle_t volatile waiter;       /* consumer sleeping in mpsc_fetch() */
+    uint32_t full;                      /* failed pushes */
+    mpsc_cell_t cell[MPSC_MAX];
+} mpsc_t;
+
+void mpsc_init(mpsc_t * q, uint32_t size); /* rounded up to a power of 2, at most MPSC_MAX */
+bool mpsc_push(mpsc_t * q, void * msg);    /* false when full */
+bool mpsc_pop(mpsc_t * q, void ** msg);    /* consumer, false when empty */
+bool mpsc_fetch(mpsc_t * q, void ** msg, TickType_t ticks); /* consumer, false on timeout */
+bool mpsc_wait2(mpsc_t * a, mpsc_t * b, TickType_t ticks);  /* consumer of both, false on timeout, pops nothing */
+uint32_t mpsc_count(mpsc_t * q);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MPSC_H */
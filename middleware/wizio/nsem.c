@@ -0,0 +1,77 @@
+/*
+ *  Notification semaphore, see nsem.h
+ *  nsem_take() stores waiter before its last look at count and the give side reads waiter
+ *  after the count is up, with a full barrier on both sides one of them always sees the other
+ *  ( same handshake as mpsc.c )
+ */
+
+#include "nsem.h"
+
+void nsem_init(nsem_t * s, uint32_t max, uint32_t initial) {
+    s->max = max ? max : 1;
+    s->count = (initial > s->max) ? s->max : initial;
+    s->waiter = NULL;
+}
+
+bool nsem_try(nsem_t * s) {
+    uint32_t c;
+    while ((c = s->count))
+        if (__sync_bool_compare_and_swap(&s->count, c, c - 1))
+            return true;
+    return false;
+}
+
+static bool nsem_up(nsem_t * s) {
+    uint32_t c;
+    do {
+        if ((c = s->count) >= s->max)
+            return false;
+    } while (!__sync_bool_compare_and_swap(&s->count, c, c + 1));
+    __sync_synchronize();
+    return true;
+}
+
+bool nsem_take(nsem_t * s, TickType_t ticks) {
+    TimeOut_t timeout;
+    TaskHandle_t self;
+    bool owner;
+    if (nsem_try(s))
+        return true;
+    if (0 == ticks)
+        return false;
+    self = xTaskGetCurrentTaskHandle();
+    vTaskSetTimeOutState(&timeout);
+    for (;;) {
+        owner = __sync_bool_compare_and_swap(&s->waiter, NULL, self) || s->waiter == self;
+        __sync_synchronize();
+        if (nsem_try(s))
+            break;
+        if (xTaskCheckForTimeOut(&timeout, &ticks)) {
+            if (owner)
+                s->waiter = NULL;
+            return false;
+        }
+        xTaskNotifyWait(0, NSEM_NOTIFY_BIT, NULL, owner ? ticks : 1);
+    }
+    if (owner)
+        s->waiter = NULL;
+    return true;
+}
+
+bool nsem_give(nsem_t * s) {
+    TaskHandle_t waiter;
+    if (!nsem_up(s))
+        return false;
+    if ((waiter = s->waiter))
+        xTaskNotify(waiter, NSEM_NOTIFY_BIT, eSetBits);
+    return true;
+}
+
+bool nsem_give_from_isr(nsem_t * s, BaseType_t * woken) {
+    TaskHandle_t waiter;
+    if (!nsem_up(s))
+        return false;
+    if ((waiter = s->waiter))
+        xTaskNotifyFromISR(waiter, NSEM_NOTIFY_BIT, eSetBits, woken);
+    return true;
+}
@@ -0,0 +1,39 @@
+/*
+ *  Counting semaphore on a task notification bit, the OSAL sem_* and the MRF24WN OSAL_SEM_*
+ *  The count is changed with compare-and-swap (ll/sc), give wakes the waiter only when one sleeps,
+ *  no queue, no list of waiting tasks and no critical section on the fast path
+ *  Made for one waiting task ( the driver or the RX task ), a second task waiting at the same time
+ *  polls every tick until the first one is gone
+ */
+
+#ifndef NSEM_H
+#define	NSEM_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define NSEM_NOTIFY_BIT     (1u << 2)   /* mpsc.h bit 0, sys_arch.h bit 1 */
+
+typedef struct {
+    volatile uint32_t count;
+    uint32_t max;
+    TaskHandle_t volatile waiter;       /* task sleeping in nsem_take() */
+} nsem_t;
+
+void nsem_init(nsem_t * s, uint32_t max, uint32_t initial);
+bool nsem_try(nsem_t * s);
+bool nsem_take(nsem_t * s, TickType_t ticks);   /* false on timeout */
+bool nsem_give(nsem_t * s);                     /* false when the count is at max */
+bool nsem_give_from_isr(nsem_t * s, BaseType_t * woken);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* NSEM_H */
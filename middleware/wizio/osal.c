@@ -3,12 +3,12 @@
 extern volatile bool g_interrupt_enabled;
 
 void mutex_free(SemaphoreHandle_t p) {
-    if (p) vQueueDelete(p);
+    rtos_delete(p);
 }
 
 int mutex_create(SemaphoreHandle_t * pp) {
     if (!pp) return 1;
-    *pp = xSemaphoreCreateMutex();
+    *pp = rtos_mutex();
     return (*pp) ? 0 : 1;
 }
 
@@ -22,40 +22,42 @@ int mutex_unlock(SemaphoreHandle_t p) {
     return pdTRUE == xSemaphoreGive(p) ? 0 : 1;
 }
 
-void sem_free(SemaphoreHandle_t p) {
-    if (p) vQueueDelete(p);
+/* binary semaphores of one waiter on a task notification bit, nsem.h */
+
+void sem_free(nsem_t * p) {
+    rtos_nsem_delete(p);
 }
 
-int sem_create(SemaphoreHandle_t * pp) {
+int sem_create(nsem_t ** pp) {
     if (!pp) return 1;
-    *pp = xSemaphoreCreateBinary();
+    *pp = rtos_nsem(1, 0);
     return (*pp) ? 0 : 1;
 }
 
-void sem_wait(SemaphoreHandle_t p) {
+void sem_wait(nsem_t * p) {
     if (!p) return;
-    while (xSemaphoreTake(p, portMAX_DELAY) != pdTRUE);
+    while (!nsem_take(p, portMAX_DELAY));
 }
 
-uint32_t sem_wait_ex(SemaphoreHandle_t p, uint32_t ms) {
+uint32_t sem_wait_ex(nsem_t * p, uint32_t ms) {
     if (!p) return 1;
     ms /= portTICK_PERIOD_MS;
     TickType_t xStartTime = xTaskGetTickCount();
-    if (pdTRUE == xSemaphoreTake(p, ms))
+    if (nsem_take(p, ms))
         return (xTaskGetTickCount() - xStartTime) * portTICK_PERIOD_MS; // elapsed
     else
         return -1; //timeout
 }
 
-void sem_signal(SemaphoreHandle_t p) {
+void sem_signal(nsem_t * p) {
     if (!p) return;
-    xSemaphoreGive(p);
+    nsem_give(p);
 }
 
-BaseType_t sem_signal_from_isr(SemaphoreHandle_t p) {
+BaseType_t sem_signal_from_isr(nsem_t * p) {
     if (!p) return pdFALSE;
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    xSemaphoreGiveFromISR(p, &xHigherPriorityTaskWoken);
+    nsem_give_from_isr(p, &xHigherPriorityTaskWoken);
     return xHigherPriorityTaskWoken;
 }
 
@@ -18,15 +18,37 @@ extern "C" {
 #include "semphr.h"
 #include "task.h"
 #include "timers.h"
+#include "rtos_static.h"
 
 void * pvPortMalloc(size_t size);
 void vPortFree(void * ptr);
 void * pvPortRealloc(void * ptr, size_t size);   
+void * pvPortCalloc(size_t nelem, size_t elsize);
 size_t xPortWantedSizeAlign(size_t size);
     
+/* a task with the scheduler running, not an ISR, a critical section, interrupts off or an exception */
+static inline bool osal_can_block(void) {
+    uint32_t status = _CP0_GET_STATUS();
+    return 0 == uxInterruptNesting && taskSCHEDULER_RUNNING == xTaskGetSchedulerState() &&
+            (status & 0x01) && 0 == (status & 0x06) && /* IE, EXL ERL */
+            ((status & portALL_IPL_BITS) >> portIPL_SHIFT) < configMAX_SYSCALL_INTERRUPT_PRIORITY;
+}
+
 #define delay_ticks(_TICKS_)    vTaskDelay( _TICKS_ )
 #define delay_ms(_MS_)          vTaskDelay( _MS_ / portTICK_PERIOD_MS )
 
+int mutex_create(SemaphoreHandle_t * pp);
+int mutex_lock(SemaphoreHandle_t p);
+int mutex_unlock(SemaphoreHandle_t p);
+void mutex_free(SemaphoreHandle_t p);
+
+int sem_create(nsem_t ** pp);
+void sem_wait(nsem_t * p);
+uint32_t sem_wait_ex(nsem_t * p, uint32_t ms); /* elapsed ms, -1 on timeout */
+void sem_signal(nsem_t * p);
+BaseType_t sem_signal_from_isr(nsem_t * p); /* pdTRUE: portEND_SWITCHING_ISR() */
+void sem_free(nsem_t * p);
+
     
     
 #ifdef	__cplusplus
@@ -0,0 +1,270 @@
+/*
+ *  Static pools of kernel objects, see rtos_static.h
+ *  a pool slot is taken and given back under a short critical section,
+ *  the object itself is built by the xxxCreateStatic() of FreeRTOS
+ */
+
+#include "sys.h"
+#include "osal.h"
+#include "rtos_static.h"
+
+#if configSUPPORT_STATIC_ALLOCATION
+
+/* idle and timer task out of the heap too */
+void vApplicationGetIdleTaskMemory(StaticTask_t ** ppxTCB, StackType_t ** ppxStack, uint32_t * pulStackSize) {
+    static StaticTask_t tcb;
+    static StackType_t stack[configMINIMAL_STACK_SIZE] __attribute__((aligned(8)));
+    *ppxTCB = &tcb;
+    *ppxStack = stack;
+    *pulStackSize = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationGetTimerTaskMemory(StaticTask_t ** ppxTCB, StackType_t ** ppxStack, uint32_t * pulStackSize) {
+    static StaticTask_t tcb;
+    static StackType_t stack[configTIMER_TASK_STACK_DEPTH] __attribute__((aligned(8)));
+    *ppxTCB = &tcb;
+    *ppxStack = stack;
+    *pulStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+
+#endif
+
+#if configUSE_STATIC_OBJECTS
+
+/* a mailbox slot holds a queue or a mpsc, both at the start of the slot */
+typedef union {
+    struct {
+        StaticQueue_t queue;
+        uint8_t storage[RTOS_STATIC_QUEUE_ITEMS * sizeof (void *)];
+    };
+    mpsc_t mpsc;
+} rtos_queue_t;
+
+/* a semaphore slot holds a kernel semaphore or a nsem */
+typedef union {
+    StaticSemaphore_t sem;
+    nsem_t nsem;
+} rtos_sem_t;
+
+typedef struct {
+    uint32_t used, peak, fails;
+} rtos_pool_stat_t;
+
+static rtos_sem_t rtos_sems[RTOS_STATIC_SEMS];
+static rtos_queue_t rtos_queues[RTOS_STATIC_QUEUES];
+static StaticTask_t rtos_tcbs[RTOS_STATIC_TASKS];
+static StackType_t rtos_stack[RTOS_STATIC_STACK_WORDS] __attribute__((aligned(8)));
+static uint32_t rtos_sems_map, rtos_queues_map, rtos_tasks_map;
+static uint32_t rtos_tasks_carved, rtos_stack_used;
+static rtos_pool_stat_t rtos_sems_st, rtos_queues_st, rtos_tasks_st;
+
+/* a task slot keeps the stack carved for it, a deleted task gives the slot back with its stack */
+static struct {
+    StackType_t * stack;
+    uint32_t words;
+} rtos_task_stacks[RTOS_STATIC_TASKS];
+
+/* one bit per slot, -1 when the pool is empty */
+static int rtos_slot_take(uint32_t * map, int count, rtos_pool_stat_t * st) {
+    int i = -1;
+    taskENTER_CRITICAL();
+    if (~*map & ((count < 32) ? (1u << count) - 1 : 0xFFFFFFFFu)) {
+        i = __builtin_ctz(~*map);
+        *map |= 1u << i;
+        if (++st->used > st->peak)
+            st->peak = st->used;
+    } else {
+        st->fails++;
+    }
+    taskEXIT_CRITICAL();
+    return i;
+}
+
+static void rtos_slot_give(uint32_t * map, int i, rtos_pool_stat_t * st) {
+    taskENTER_CRITICAL();
+    *map &= ~(1u << i);
+    st->used--;
+    taskEXIT_CRITICAL();
+}
+
+static StaticSemaphore_t * rtos_sem_slot(void) {
+    int i = rtos_slot_take(&rtos_sems_map, RTOS_STATIC_SEMS, &rtos_sems_st);
+    return (i < 0) ? NULL : &rtos_sems[i].sem;
+}
+
+SemaphoreHandle_t rtos_sem_binary(void) {
+    StaticSemaphore_t * s = rtos_sem_slot();
+    return s ? xSemaphoreCreateBinaryStatic(s) : NULL;
+}
+
+SemaphoreHandle_t rtos_sem_counting(UBaseType_t max, UBaseType_t initial) {
+    StaticSemaphore_t * s = rtos_sem_slot();
+    return s ? xSemaphoreCreateCountingStatic(max, initial, s) : NULL;
+}
+
+SemaphoreHandle_t rtos_mutex(void) {
+    StaticSemaphore_t * s = rtos_sem_slot();
+    return s ? xSemaphoreCreateMutexStatic(s) : NULL;
+}
+
+QueueHandle_t rtos_queue(UBaseType_t length) {
+    int i;
+    if (length > RTOS_STATIC_QUEUE_ITEMS) {
+        rtos_queues_st.fails++;
+        return NULL;
+    }
+    if ((i = rtos_slot_take(&rtos_queues_map, RTOS_STATIC_QUEUES, &rtos_queues_st)) < 0)
+        return NULL;
+    return xQueueCreateStatic(length, sizeof (void *), rtos_queues[i].storage, &rtos_queues[i].queue);
+}
+
+void rtos_delete(void * handle) {
+    uint8_t * p = (uint8_t *) handle;
+    if (NULL == handle)
+        return;
+    vQueueDelete((QueueHandle_t) handle);
+    if (p >= (uint8_t *) rtos_sems && p < (uint8_t *) &rtos_sems[RTOS_STATIC_SEMS])
+        rtos_slot_give(&rtos_sems_map, (rtos_sem_t *) p - rtos_sems, &rtos_sems_st);
+    else if (p >= (uint8_t *) rtos_queues && p < (uint8_t *) &rtos_queues[RTOS_STATIC_QUEUES])
+        rtos_slot_give(&rtos_queues_map, (rtos_queue_t *) p - rtos_queues, &rtos_queues_st);
+}
+
+nsem_t * rtos_nsem(uint32_t max, uint32_t initial) {
+    int i = rtos_slot_take(&rtos_sems_map, RTOS_STATIC_SEMS, &rtos_sems_st);
+    if (i < 0)
+        return NULL;
+    nsem_init(&rtos_sems[i].nsem, max, initial);
+    return &rtos_sems[i].nsem;
+}
+
+void rtos_nsem_delete(nsem_t * s) {
+    if (s)
+        rtos_slot_give(&rtos_sems_map, (rtos_sem_t *) s - rtos_sems, &rtos_sems_st);
+}
+
+mpsc_t * rtos_mpsc(UBaseType_t length) {
+    int i;
+    if (length > MPSC_MAX) {
+        rtos_queues_st.fails++;
+        return NULL;
+    }
+    if ((i = rtos_slot_take(&rtos_queues_map, RTOS_STATIC_QUEUES, &rtos_queues_st)) < 0)
+        return NULL;
+    mpsc_init(&rtos_queues[i].mpsc, length);
+    return &rtos_queues[i].mpsc;
+}
+
+void rtos_mpsc_delete(mpsc_t * q) {
+    if (q)
+        rtos_slot_give(&rtos_queues_map, (rtos_queue_t *) q - rtos_queues, &rtos_queues_st);
+}
+
+/* smallest free slot with a stack big enough, else a new slot carved from the arena, -1 when neither */
+static int rtos_task_slot_take(uint32_t words) {
+    int i, best = -1;
+    taskENTER_CRITICAL();
+    for (i = 0; i < rtos_tasks_carved; i++)
+        if (0 == (rtos_tasks_map & (1u << i)) && rtos_task_stacks[i].words >= words
+                && (best < 0 || rtos_task_stacks[i].words < rtos_task_stacks[best].words))
+            best = i;
+    if (best < 0 && rtos_tasks_carved < RTOS_STATIC_TASKS && rtos_stack_used + words <= RTOS_STATIC_STACK_WORDS) {
+        best = rtos_tasks_carved++;
+        rtos_task_stacks[best].stack = &rtos_stack[rtos_stack_used];
+        rtos_task_stacks[best].words = words;
+        rtos_stack_used += words;
+    }
+    if (best >= 0) {
+        rtos_tasks_map |= 1u << best;
+        if (++rtos_tasks_st.used > rtos_tasks_st.peak)
+            rtos_tasks_st.peak = rtos_tasks_st.used;
+    } else {
+        rtos_tasks_st.fails++;
+    }
+    taskEXIT_CRITICAL();
+    return best;
+}
+
+BaseType_t rtos_task_create(TaskFunction_t entry, const char * name, uint32_t words, void * arg, UBaseType_t prio, TaskHandle_t * handle) {
+    TaskHandle_t task;
+    int i;
+    words = (words + 1) & ~1u; // keeps the next stack 8 byte aligned
+    if ((i = rtos_task_slot_take(words)) < 0) {
+        LOG("[RTOS] no static task for %s (%u words)\n", name, words);
+        return pdFAIL;
+    }
+    task = xTaskCreateStatic(entry, name, rtos_task_stacks[i].words, arg, prio, rtos_task_stacks[i].stack, &rtos_tcbs[i]);
+    if (NULL == task)
+        rtos_slot_give(&rtos_tasks_map, i, &rtos_tasks_st);
+    if (handle)
+        *handle = task;
+    return task ? pdPASS : pdFAIL;
+}
+
+void rtos_task_cleanup(void * tcb) {
+    StaticTask_t * t = (StaticTask_t *) tcb;
+    if (t >= rtos_tcbs && t < &rtos_tcbs[RTOS_STATIC_TASKS])
+        rtos_slot_give(&rtos_tasks_map, t - rtos_tcbs, &rtos_tasks_st);
+}
+
+void rtos_static_dump(void) {
+    LOG("[RTOS] sems   %2u/%u peak %2u fail %u\n", rtos_sems_st.used, RTOS_STATIC_SEMS, rtos_sems_st.peak, rtos_sems_st.fails);
+    LOG("[RTOS] queues %2u/%u peak %2u fail %u\n", rtos_queues_st.used, RTOS_STATIC_QUEUES, rtos_queues_st.peak, rtos_queues_st.fails);
+    LOG("[RTOS] tasks  %2u/%u peak %2u fail %u stack %u/%u words\n", rtos_tasks_st.used, RTOS_STATIC_TASKS,
+            rtos_tasks_st.peak, rtos_tasks_st.fails, rtos_stack_used, RTOS_STATIC_STACK_WORDS);
+}
+
+#else
+
+SemaphoreHandle_t rtos_sem_binary(void) {
+    return xSemaphoreCreateBinary();
+}
+
+SemaphoreHandle_t rtos_sem_counting(UBaseType_t max, UBaseType_t initial) {
+    return xSemaphoreCreateCounting(max, initial);
+}
+
+SemaphoreHandle_t rtos_mutex(void) {
+    return xSemaphoreCreateMutex();
+}
+
+QueueHandle_t rtos_queue(UBaseType_t length) {
+    return xQueueCreate(length, sizeof (void *));
+}
+
+void rtos_delete(void * handle) {
+    if (handle)
+        vQueueDelete((QueueHandle_t) handle);
+}
+
+nsem_t * rtos_nsem(uint32_t max, uint32_t initial) {
+    nsem_t * s;
+    if ((s = pvPortMalloc(sizeof (nsem_t))))
+        nsem_init(s, max, initial);
+    return s;
+}
+
+void rtos_nsem_delete(nsem_t * s) {
+    vPortFree(s);
+}
+
+mpsc_t * rtos_mpsc(UBaseType_t length) {
+    mpsc_t * q;
+    if (length > MPSC_MAX)
+        return NULL;
+    if ((q = pvPortMalloc(sizeof (mpsc_t))))
+        mpsc_init(q, length);
+    return q;
+}
+
+void rtos_mpsc_delete(mpsc_t * q) {
+    vPortFree(q);
+}
+
+BaseType_t rtos_task_create(TaskFunction_t entry, const char * name, uint32_t words, void * arg, UBaseType_t prio, TaskHandle_t * handle) {
+    return xTaskCreate(entry, name, words, arg, prio, handle);
+}
+
+void rtos_static_dump(void) {
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ *  Kernel objects of the middleware, configUSE_STATIC_OBJECTS in FreeRTOSConfig.h
+ *  With it set semaphores ( kernel or nsem.h ), mutexes and mailboxes ( queues or mpsc.h ) come from fixed pools in .bss,
+ *  task stacks and TCBs from a static arena, a deleted task gives its slot and stack back for the next
+ *  task of the same or a smaller stack ( portCLEAN_UP_TCB in FreeRTOSConfig.h )
+ *  Without it every call maps to the xxxCreate() from the heap
+ *  An exhausted pool returns NULL the same way as an empty heap, rtos_static_dump() shows the use
+ */
+
+#ifndef RTOS_STATIC_H
+#define	RTOS_STATIC_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "semphr.h"
+#include "task.h"
+#include "mpsc.h"
+#include "nsem.h"
+
+#define RTOS_STATIC_SEMS            32      /* binary, counting, mutex and nsem */
+#define RTOS_STATIC_QUEUES          12      /* lwIP mailboxes, queue or mpsc */
+#define RTOS_STATIC_QUEUE_ITEMS     16      /* of void *, >= the *_MBOX_SIZE in lwipopts.h */
+#define RTOS_STATIC_TASKS           8
+#define RTOS_STATIC_STACK_WORDS     (15 * 1024) /* TCPIP 10k + WiFi driver + apps */
+
+SemaphoreHandle_t rtos_sem_binary(void);
+SemaphoreHandle_t rtos_sem_counting(UBaseType_t max, UBaseType_t initial);
+SemaphoreHandle_t rtos_mutex(void);
+QueueHandle_t rtos_queue(UBaseType_t length); /* items are void * */
+void rtos_delete(void * handle); /* semaphore, mutex or queue */
+nsem_t * rtos_nsem(uint32_t max, uint32_t initial);
+void rtos_nsem_delete(nsem_t * s);
+mpsc_t * rtos_mpsc(UBaseType_t length);
+void rtos_mpsc_delete(mpsc_t * q);
+
+BaseType_t rtos_task_create(TaskFunction_t entry, const char * name, uint32_t words, void * arg, UBaseType_t prio, TaskHandle_t * handle);
+void rtos_task_cleanup(void * tcb); /* portCLEAN_UP_TCB, the TCB of a deleted task */
+
+void rtos_static_dump(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* RTOS_STATIC_H */
@@ -0,0 +1,117 @@
+/*
+ *  Size-class slab front end of the heap
+ *  called from pvPortMalloc/vPortFree/pvPortRealloc, free lists are guarded by a short critical section
+ */
+
+#include "sys.h"
+#include "osal.h"
+#include "slab.h"
+
+#if configUSE_SLAB
+
+#define SLAB_PAGES      (SLAB_ARENA_SIZE / SLAB_PAGE_SIZE)
+#define SLAB_NO_CLASS   0xFF
+
+typedef struct slab_obj_s {
+    struct slab_obj_s * next;
+} slab_obj_t;
+
+typedef struct {
+    slab_obj_t * free;
+    slab_stat_t st;
+} slab_class_t;
+
+static uint8_t slab_arena[SLAB_ARENA_SIZE] __attribute__((aligned(16)));
+static uint8_t slab_page_class[SLAB_PAGES];
+static uint32_t slab_next_page;
+static slab_class_t slab_class[SLAB_CLASSES];
+
+static inline int slab_class_of(size_t size) {
+    if (size <= (1u << SLAB_MIN_SHIFT))
+        return 0;
+    return 32 - __builtin_clz(size - 1) - SLAB_MIN_SHIFT;
+}
+
+/* critical section held */
+static void slab_grow(int cls) {
+    slab_class_t * c = &slab_class[cls];
+    uint32_t size = 1u << (SLAB_MIN_SHIFT + cls);
+    uint8_t * p = &slab_arena[slab_next_page * SLAB_PAGE_SIZE];
+    uint8_t * end = p + SLAB_PAGE_SIZE;
+    slab_page_class[slab_next_page++] = cls;
+    for (; p < end; p += size) {
+        ((slab_obj_t *) p)->next = c->free;
+        c->free = (slab_obj_t *) p;
+    }
+    c->st.pages++;
+}
+
+void * slab_malloc(size_t size) {
+    slab_class_t * c;
+    slab_obj_t * o;
+    uint32_t elapsed, start = ReadCoreTimer();
+    if (0 == size || size > SLAB_MAX_SIZE)
+        return NULL;
+    c = &slab_class[slab_class_of(size)];
+    taskENTER_CRITICAL();
+    if (NULL == c->free && slab_next_page < SLAB_PAGES)
+        slab_grow(c - slab_class);
+    if ((o = c->free)) {
+        c->free = o->next;
+        c->st.allocs++;
+        c->st.requested += size;
+        if (++c->st.used > c->st.peak)
+            c->st.peak = c->st.used;
+        elapsed = ReadCoreTimer() - start;
+        c->st.ticks += elapsed;
+        if (elapsed > c->st.max_ticks)
+            c->st.max_ticks = elapsed;
+    } else {
+        c->st.fallbacks++;
+    }
+    taskEXIT_CRITICAL();
+    return o;
+}
+
+size_t slab_size(void * ptr) {
+    uint32_t offset = (uint8_t *) ptr - slab_arena;
+    if ((uint8_t *) ptr < slab_arena || offset >= SLAB_ARENA_SIZE)
+        return 0;
+    return 1u << (SLAB_MIN_SHIFT + slab_page_class[offset / SLAB_PAGE_SIZE]);
+}
+
+void slab_free(void * ptr) {
+    uint32_t offset = (uint8_t *) ptr - slab_arena;
+    slab_class_t * c = &slab_class[slab_page_class[offset / SLAB_PAGE_SIZE]];
+    taskENTER_CRITICAL();
+    ((slab_obj_t *) ptr)->next = c->free;
+    c->free = (slab_obj_t *) ptr;
+    c->st.used--;
+    taskEXIT_CRITICAL();
+}
+
+void slab_stat(int cls, slab_stat_t * st) {
+    if (cls < 0 || cls >= SLAB_CLASSES || NULL == st)
+        return;
+    taskENTER_CRITICAL();
+    *st = slab_class[cls].st;
+    taskEXIT_CRITICAL();
+    st->size = 1u << (SLAB_MIN_SHIFT + cls);
+}
+
+void slab_dump(void) {
+    slab_stat_t st;
+    size_t free_bytes = xPortGetFreeHeapSize(), largest = xPortGetLargestFreeBlockSize();
+    int i;
+    for (i = 0; i < SLAB_CLASSES; i++) {
+        slab_stat(i, &st);
+        LOG("[SLAB] %3u: pages %2u used %4u peak %4u allocs %6u fallback %4u waste %2u%% avg %u max %u ticks\n",
+                st.size, st.pages, st.used, st.peak, st.allocs, st.fallbacks,
+                st.allocs ? 100 - (uint32_t) (100ull * st.requested / ((uint64_t) st.allocs * st.size)) : 0,
+                st.allocs ? st.ticks / st.allocs : 0, st.max_ticks);
+    }
+    LOG("[SLAB] pages %u/%u, heap free %u largest %u fragmentation %u%%\n", slab_next_page, SLAB_PAGES,
+            free_bytes, largest, free_bytes ? 100 - (uint32_t) (100ull * largest / free_bytes) : 0);
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ *  Size-class slab front end of the heap, configUSE_SLAB in FreeRTOSConfig.h
+ *  Requests up to SLAB_MAX_SIZE come from per-class free lists in a static arena,
+ *  pages are given to a class on demand and never returned
+ *  A class without free objects and without free pages falls back to the heap
+ */
+
+#ifndef SLAB_H
+#define	SLAB_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SLAB_MIN_SHIFT      4    /* 16 bytes */
+#define SLAB_CLASSES        5    /* 16, 32, 64, 128, 256 */
+#define SLAB_MAX_SIZE       (1u << (SLAB_MIN_SHIFT + SLAB_CLASSES - 1))
+#define SLAB_PAGE_SIZE      1024
+#define SLAB_ARENA_SIZE     (32 * 1024)
+
+typedef struct {
+    uint32_t size;      /* object size */
+    uint32_t pages;
+    uint32_t used, peak;
+    uint32_t allocs, fallbacks;
+    uint32_t requested; /* bytes asked for, vs allocs * size is the internal waste */
+    uint32_t ticks, max_ticks;
+} slab_stat_t;
+
+void * slab_malloc(size_t size);
+void slab_free(void * ptr);
+size_t slab_size(void * ptr); /* object size, 0 if ptr is not from the slab */
+void slab_stat(int cls, slab_stat_t * st);
+void slab_dump(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SLAB_H */
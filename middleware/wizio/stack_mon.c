@@ -0,0 +1,88 @@
+/*
+ *  Stack high-water monitor, see stack_mon.h
+ *  the hooks run with the kernel critical section held, the sampler takes it for each update
+ */
+
+#include "sys.h"
+#include "osal.h"
+#include "stack_mon.h"
+
+#if configUSE_STACK_MONITOR
+
+static stack_mon_entry_t stack_mon[STACK_MON_TASKS];
+
+static stack_mon_entry_t * stack_mon_find(const char * name) {
+    uint32_t i;
+    for (i = 0; i < STACK_MON_TASKS && stack_mon[i].name[0]; i++) {
+        if (0 == strncmp(stack_mon[i].name, name, configMAX_TASK_NAME_LEN))
+            return &stack_mon[i];
+    }
+    if (i == STACK_MON_TASKS)
+        return NULL;
+    strncpy(stack_mon[i].name, name, configMAX_TASK_NAME_LEN - 1);
+    stack_mon[i].min_free = 0xFFFFFFFF;
+    return &stack_mon[i];
+}
+
+static void stack_mon_update(const char * name, uint32_t free_words) {
+    stack_mon_entry_t * e = stack_mon_find(name);
+    if (e && free_words < e->min_free)
+        e->min_free = free_words;
+}
+
+/* traceTASK_CREATE */
+void stack_mon_task_create(const char * name, unsigned long words) {
+    stack_mon_entry_t * e = stack_mon_find(name);
+    if (NULL == e)
+        return;
+    if (words > e->size)
+        e->size = words;
+    e->instances++;
+}
+
+/* traceTASK_DELETE, the last look at the stack */
+void stack_mon_task_delete(void * handle) {
+    stack_mon_update(pcTaskGetName((TaskHandle_t) handle), uxTaskGetStackHighWaterMark((TaskHandle_t) handle));
+}
+
+void stack_mon_sample(void) {
+    static TaskStatus_t status[STACK_MON_TASKS];
+    uint32_t i, n;
+    n = uxTaskGetSystemState(status, STACK_MON_TASKS, NULL);
+    for (i = 0; i < n; i++) {
+        taskENTER_CRITICAL();
+        stack_mon_update(status[i].pcTaskName, status[i].usStackHighWaterMark);
+        taskEXIT_CRITICAL();
+    }
+}
+
+uint32_t stack_mon_suggest(const stack_mon_entry_t * e) {
+    uint32_t used = e->size - e->min_free;
+    uint32_t margin = used / 4;
+    if (margin < STACK_MON_MARGIN)
+        margin = STACK_MON_MARGIN;
+    return (used + margin + STACK_MON_ROUND - 1) & ~(STACK_MON_ROUND - 1);
+}
+
+void stack_mon_dump(void) {
+    stack_mon_entry_t e;
+    uint32_t i, suggest, total = 0, total_suggest = 0;
+    stack_mon_sample();
+    LOG("[STK] %-*s  size  used  free suggest\n", configMAX_TASK_NAME_LEN, "task");
+    for (i = 0; i < STACK_MON_TASKS && stack_mon[i].name[0]; i++) {
+        taskENTER_CRITICAL();
+        e = stack_mon[i];
+        taskEXIT_CRITICAL();
+        if (0 == e.size || e.min_free > e.size)
+            continue; // created before the monitor or never sampled
+        suggest = stack_mon_suggest(&e);
+        LOG("[STK] %-*s %5u %5u %5u %5u%s x%u\n", configMAX_TASK_NAME_LEN, e.name, e.size, e.size - e.min_free,
+                e.min_free, suggest, suggest > e.size ? " GROW" : "", e.instances);
+        total += e.size;
+        total_suggest += suggest;
+    }
+    LOG("[STK] total %u words, suggested %u, %d bytes to reclaim\n", total, total_suggest,
+            (int) (total - total_suggest) * (int) sizeof (StackType_t));
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ *  Stack high-water monitor, configUSE_STACK_MONITOR in FreeRTOSConfig.h
+ *  Keeps the worst case of every task by name, over all instances of it ( reconnects, per connection tasks ):
+ *  traceTASK_CREATE records the stack size, traceTASK_DELETE and stack_mon_sample() the high-water mark
+ *  stack_mon_dump() prints the table with a suggested size, sizes are in words
+ */
+
+#ifndef STACK_MON_H
+#define	STACK_MON_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define STACK_MON_TASKS     24      /* names kept */
+#define STACK_MON_MARGIN    64      /* words, at least, or a quarter of the worst use */
+#define STACK_MON_ROUND     16      /* words */
+
+typedef struct {
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t size;      /* words, the largest instance */
+    uint32_t min_free;  /* words, the worst instance */
+    uint32_t instances;
+} stack_mon_entry_t;
+
+#if configUSE_STACK_MONITOR
+
+void stack_mon_sample(void); /* all running tasks */
+void stack_mon_dump(void);   /* samples first */
+uint32_t stack_mon_suggest(const stack_mon_entry_t * e);
+
+#else
+
+static inline void stack_mon_sample(void) {}
+static inline void stack_mon_dump(void) {}
+
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* STACK_MON_H */
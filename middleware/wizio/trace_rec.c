@@ -0,0 +1,102 @@
+/*
+ *  Kernel event recorder, see trace_rec.h
+ *  a record is written with interrupts off for a few instructions, so the hooks can run
+ *  from any interrupt level, the running task is remembered from the last switch record
+ */
+
+#include "sys.h"
+#include "osal.h"
+#include "trace_rec.h"
+
+#if configUSE_TRACE_RECORDER
+
+#define TRACE_REC_MASK          (TRACE_REC_SIZE - 1)
+#define TRACE_REC_DUMP_LINES    32 /* then wait for the log to drain */
+
+typedef struct {
+    uint8_t number;
+    char name[configMAX_TASK_NAME_LEN];
+} trace_name_t;
+
+static trace_rec_t trace_ring[TRACE_REC_SIZE];
+static uint32_t trace_head; /* records written since start */
+static volatile bool trace_on = true;
+static uint8_t trace_task;
+static uint16_t trace_queues;
+static trace_name_t trace_names[TRACE_REC_NAMES];
+
+static inline void trace_put(uint8_t event, uint8_t task, uint16_t arg) {
+    trace_rec_t * r;
+    uint32_t status;
+    if (!trace_on)
+        return;
+    status = __builtin_disable_interrupts();
+    r = &trace_ring[trace_head++ & TRACE_REC_MASK];
+    r->time = ReadCoreTimer();
+    r->event = event;
+    r->task = task;
+    r->arg = arg;
+    if (status & 1)
+        __builtin_enable_interrupts();
+}
+
+/* traceTASK_SWITCHED_IN */
+void trace_rec_switch(unsigned long number) {
+    trace_task = number;
+    trace_put(TRACE_REC_SWITCH, number, 0);
+}
+
+/* traceTASK_CREATE */
+void trace_rec_task_create(unsigned long number, const char * name, unsigned long priority) {
+    trace_name_t * n = &trace_names[number % TRACE_REC_NAMES];
+    n->number = number;
+    strncpy(n->name, name, sizeof (n->name) - 1);
+    trace_put(TRACE_REC_TASK_CREATE, number, priority);
+}
+
+/* traceQUEUE_CREATE, the number goes to uxQueueNumber */
+unsigned long trace_rec_queue_create(unsigned long type) {
+    uint16_t number = ++trace_queues & 0x0FFF;
+    trace_put(TRACE_REC_QUEUE_CREATE, trace_task, number | type << 12);
+    return number;
+}
+
+/* queue, notify and ISR hooks, in the context of the running task */
+void trace_rec_event(unsigned long event, unsigned long arg) {
+    trace_put(event, trace_task, arg);
+}
+
+void trace_rec_user(uint8_t event, uint16_t id) {
+    trace_put(event, trace_task, id);
+}
+
+void trace_rec_start(void) {
+    trace_head = 0;
+    trace_on = true;
+}
+
+void trace_rec_stop(void) {
+    trace_on = false;
+}
+
+void trace_rec_dump(void) {
+    uint32_t i, n, first;
+    trace_rec_t * r;
+    trace_on = false;
+    n = (trace_head < TRACE_REC_SIZE) ? trace_head : TRACE_REC_SIZE;
+    first = trace_head - n;
+    LOG("[TRC] BEGIN %u %u\n", SYS_CLK_FREQ / 2, n);
+    for (i = 0; i < TRACE_REC_NAMES; i++) {
+        if (trace_names[i].name[0])
+            LOG("[TRC] N %u %s\n", trace_names[i].number, trace_names[i].name);
+    }
+    for (i = 0; i < n; i++) {
+        r = &trace_ring[(first + i) & TRACE_REC_MASK];
+        LOG("[TRC] %08X %c %u %u\n", r->time, r->event, r->task, r->arg);
+        if (0 == (i + 1) % TRACE_REC_DUMP_LINES && taskSCHEDULER_RUNNING == xTaskGetSchedulerState())
+            delay_ms(40); // 32 lines of ~24 chars at 230400
+    }
+    LOG("[TRC] END\n");
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ *  Kernel event recorder, configUSE_TRACE_RECORDER in FreeRTOSConfig.h
+ *  The FreeRTOS trace macros and traceISR_ENTER/EXIT write 8 byte records into a RAM ring,
+ *  the oldest records are overwritten until trace_rec_stop()
+ *  trace_rec_dump() prints the ring as [TRC] lines, tools/trace2json.py turns a log capture
+ *  into Chrome trace / Perfetto JSON (chrome://tracing, ui.perfetto.dev)
+ */
+
+#ifndef TRACE_REC_H
+#define	TRACE_REC_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+
+#define TRACE_REC_SIZE          2048    /* records, power of 2 */
+#define TRACE_REC_NAMES         32      /* task names kept for the dump */
+#define TRACE_REC_STALL_MS      5000    /* handshake longer than this dumps the ring */
+
+/* event codes, printable to keep raw dumps readable */
+#define TRACE_REC_SWITCH        'T'     /* task switched in */
+#define TRACE_REC_TASK_CREATE   'C'     /* arg priority */
+#define TRACE_REC_TASK_DELETE   'D'
+#define TRACE_REC_ISR_ENTER     'I'     /* arg vector */
+#define TRACE_REC_ISR_EXIT      'i'
+#define TRACE_REC_QUEUE_CREATE  'Q'     /* arg queue number | type << 12 */
+#define TRACE_REC_SEND          'S'     /* arg queue number */
+#define TRACE_REC_SEND_ISR      's'
+#define TRACE_REC_RECEIVE       'R'
+#define TRACE_REC_RECEIVE_ISR   'r'
+#define TRACE_REC_BLOCK_SEND    'w'
+#define TRACE_REC_BLOCK_RECEIVE 'W'
+#define TRACE_REC_NOTIFY        'N'     /* arg task number notified */
+#define TRACE_REC_NOTIFY_WAIT   'n'
+#define TRACE_REC_USER_BEGIN    'U'     /* arg user id */
+#define TRACE_REC_USER_END      'u'
+#define TRACE_REC_USER_MARK     'M'
+
+/* user ids */
+#define TRACE_REC_ID_HANDSHAKE  1
+
+typedef struct {
+    uint32_t time;      /* core timer */
+    uint8_t event;
+    uint8_t task;       /* uxTCBNumber of the running task */
+    uint16_t arg;
+} trace_rec_t;
+
+#if configUSE_TRACE_RECORDER
+
+void trace_rec_start(void);
+void trace_rec_stop(void);
+void trace_rec_user(uint8_t event, uint16_t id);
+void trace_rec_dump(void); /* stops the recorder, restart with trace_rec_start() */
+
+#define TRACE_REC_BEGIN(ID)     trace_rec_user(TRACE_REC_USER_BEGIN, ID)
+#define TRACE_REC_END(ID)       trace_rec_user(TRACE_REC_USER_END, ID)
+#define TRACE_REC_MARK(ID)      trace_rec_user(TRACE_REC_USER_MARK, ID)
+
+#else
+
+static inline void trace_rec_start(void) {}
+static inline void trace_rec_stop(void) {}
+static inline void trace_rec_dump(void) {}
+
+#define TRACE_REC_BEGIN(ID)
+#define TRACE_REC_END(ID)
+#define TRACE_REC_MARK(ID)
+
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* TRACE_REC_H */
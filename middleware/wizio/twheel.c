@@ -0,0 +1,168 @@
+/*
+ *  Hierarchical timer wheel, see twheel.h
+ *  A node goes to the lowest level whose span covers expire - now, level L slot is (expire >> 6L) & 63
+ *  When now crosses a multiple of 2^6L the slot of level L is taken out and its nodes added again,
+ *  they land in a lower level ( Linux timer wheel before 4.8 )
+ */
+
+#include <stddef.h>
+#include "twheel.h"
+
+static inline uint32_t twheel_level(uint32_t delta) {
+    uint32_t level = 0;
+    while (level < TWHEEL_LEVELS - 1 && delta >= (1u << (TWHEEL_BITS * (level + 1))))
+        level++;
+    return level;
+}
+
+static void twheel_link(twheel_t * w, twheel_node_t * n) {
+    uint32_t delta, level, at, i;
+    if ((int32_t) (n->expire - w->now) < 0)
+        n->expire = w->now;
+    delta = n->expire - w->now;
+    at = n->expire;
+    if (delta >= TWHEEL_SPAN)
+        at = w->now + TWHEEL_SPAN - 1; // back to the top level at the next cascade
+    level = twheel_level(at - w->now);
+    i = (at >> (TWHEEL_BITS * level)) & TWHEEL_MASK;
+    n->next = w->slot[level][i];
+    if (n->next)
+        n->next->pprev = &n->next;
+    n->pprev = &w->slot[level][i];
+    w->slot[level][i] = n;
+    w->map[level] |= 1ull << i;
+}
+
+static void twheel_unlink(twheel_t * w, twheel_node_t * n) {
+    uintptr_t i;
+    *n->pprev = n->next;
+    if (n->next) {
+        n->next->pprev = n->pprev;
+    } else {
+        i = (uintptr_t) (n->pprev - &w->slot[0][0]);
+        if (i < TWHEEL_LEVELS * TWHEEL_SLOTS) // it was the only node of the slot
+            w->map[i / TWHEEL_SLOTS] &= ~(1ull << (i % TWHEEL_SLOTS));
+    }
+    n->pprev = NULL;
+}
+
+void twheel_init(twheel_t * w, uint32_t now) {
+    uint32_t level, i;
+    w->now = now;
+    w->count = 0;
+    w->run = NULL;
+    for (level = 0; level < TWHEEL_LEVELS; level++) {
+        w->map[level] = 0;
+        for (i = 0; i < TWHEEL_SLOTS; i++)
+            w->slot[level][i] = NULL;
+    }
+}
+
+void twheel_add(twheel_t * w, twheel_node_t * n, uint32_t expire) {
+    n->expire = expire;
+    twheel_link(w, n);
+    w->count++;
+}
+
+void twheel_del(twheel_t * w, twheel_node_t * n) {
+    if (NULL == n->pprev)
+        return; // expired already
+    twheel_unlink(w, n);
+    w->count--;
+}
+
+/* slots of 'level' rotated to start at index 'cur' */
+static inline uint64_t twheel_rotate(uint64_t map, uint32_t cur) {
+    return cur ? (map >> cur) | (map << (TWHEEL_SLOTS - cur)) : map;
+}
+
+uint32_t twheel_next(twheel_t * w) {
+    uint32_t level, shift, cur, k, at, next = TWHEEL_IDLE;
+    uint64_t rot;
+    if (0 == w->count)
+        return TWHEEL_IDLE;
+    if (w->map[0]) {
+        rot = twheel_rotate(w->map[0], w->now & TWHEEL_MASK);
+        next = __builtin_ctzll(rot); // level 0 holds exact times
+    }
+    for (level = 1; level < TWHEEL_LEVELS; level++) {
+        if (0 == w->map[level])
+            continue;
+        shift = TWHEEL_BITS * level;
+        cur = (w->now >> shift) & TWHEEL_MASK;
+        rot = twheel_rotate(w->map[level], cur);
+        at = (w->now >> shift) << shift; // start of the current slot
+        if (at != w->now)
+            rot &= ~1ull; // the current slot is cascaded already, a node there waits a full turn
+        k = rot ? (uint32_t) __builtin_ctzll(rot) : TWHEEL_SLOTS;
+        at += k << shift;
+        if (at - w->now < next)
+            next = at - w->now;
+    }
+    return next;
+}
+
+static void twheel_cascade(twheel_t * w) {
+    uint32_t level, i;
+    twheel_node_t * n, * list;
+    for (level = 1; level < TWHEEL_LEVELS; level++) {
+        i = (w->now >> (TWHEEL_BITS * level)) & TWHEEL_MASK;
+        list = w->slot[level][i];
+        w->slot[level][i] = NULL;
+        w->map[level] &= ~(1ull << i);
+        while ((n = list)) {
+            list = n->next;
+            twheel_link(w, n);
+        }
+        if (i)
+            break;
+    }
+}
+
+void twheel_advance(twheel_t * w, uint32_t now, twheel_cb_t cb, void * ctx) {
+    twheel_node_t * n;
+    uint32_t t, next;
+    while ((int32_t) (now - w->now) >= 0) {
+        t = w->now;
+        if (0 == (t & TWHEEL_MASK))
+            twheel_cascade(w);
+        w->now = t + 1; // nodes added by the callbacks go after t
+        if ((w->run = w->slot[0][t & TWHEEL_MASK])) {
+            w->run->pprev = &w->run; // a node added for t + 64 lands in the same slot
+            w->slot[0][t & TWHEEL_MASK] = NULL;
+            w->map[0] &= ~(1ull << (t & TWHEEL_MASK));
+        }
+        while ((n = w->run)) {
+            twheel_unlink(w, n);
+            w->count--;
+            cb(n, ctx);
+        }
+        if ((int32_t) (now - w->now) < 0)
+            break;
+        next = twheel_next(w); // skip the empty slots
+        if (next > now - w->now + 1)
+            next = now - w->now + 1;
+        w->now += next;
+    }
+}
+
+void twheel_rebase(twheel_t * w, uint32_t now) {
+    uint32_t level, i, shift = now - w->now;
+    twheel_node_t * n, * list = NULL;
+    for (level = 0; level < TWHEEL_LEVELS; level++) {
+        for (i = 0; i < TWHEEL_SLOTS; i++) {
+            while ((n = w->slot[level][i])) {
+                twheel_unlink(w, n);
+                n->expire += shift;
+                n->next = list;
+                list = n;
+            }
+        }
+        w->map[level] = 0;
+    }
+    w->now = now;
+    while ((n = list)) {
+        list = n->next;
+        twheel_link(w, n);
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ *  Hierarchical timer wheel of intrusive nodes, the lwIP sys_timeout with LWIP_TIMERS_WHEEL
+ *  5 levels of 64 slots, 1 ms .. 2^30 ms, add and delete are O(1), a node moves down at most once per level
+ *  Idle periods are skipped: twheel_next() gives the time to the next expiry or cascade of an occupied slot
+ *  Not locked, all calls from one thread
+ */
+
+#ifndef TWHEEL_H
+#define	TWHEEL_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TWHEEL_BITS     6
+#define TWHEEL_SLOTS    (1u << TWHEEL_BITS)
+#define TWHEEL_MASK     (TWHEEL_SLOTS - 1)
+#define TWHEEL_LEVELS   5
+#define TWHEEL_SPAN     (1u << (TWHEEL_BITS * TWHEEL_LEVELS)) /* longer timeouts wait in the top level */
+#define TWHEEL_IDLE     0xFFFFFFFFu
+
+typedef struct twheel_node {
+    struct twheel_node * next;
+    struct twheel_node ** pprev;
+    uint32_t expire;            /* ms */
+} twheel_node_t;
+
+typedef struct {
+    uint32_t now;               /* first ms not processed yet */
+    uint32_t count;
+    twheel_node_t * run;        /* expired nodes of the slot being run */
+    uint64_t map[TWHEEL_LEVELS];
+    twheel_node_t * slot[TWHEEL_LEVELS][TWHEEL_SLOTS];
+} twheel_t;
+
+/* the node is out of the wheel, the callback may add or delete any node */
+typedef void (* twheel_cb_t)(twheel_node_t * node, void * ctx);
+
+void twheel_init(twheel_t * w, uint32_t now);
+void twheel_add(twheel_t * w, twheel_node_t * node, uint32_t expire); /* expire in the past runs on the next advance */
+void twheel_del(twheel_t * w, twheel_node_t * node);
+uint32_t twheel_next(twheel_t * w); /* ms from w->now, TWHEEL_IDLE when empty */
+void twheel_advance(twheel_t * w, uint32_t now, twheel_cb_t cb, void * ctx); /* runs everything up to now */
+void twheel_rebase(twheel_t * w, uint32_t now); /* moves all nodes by now - w->now */
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* TWHEEL_H */
@@ -5,51 +5,16 @@
 
 #include <stddef.h>
 #include <string.h>
+#include "heap_trace.h"
 
-//#define UMM_MALLOC
-
-#ifdef UMM_MALLOC
-#include "umm_malloc.h"
-
-void* pvPortMalloc(size_t size) {
-    return (void*) umm_malloc(size);
-}
-
-void vPortFree(void * ptr) {
-    umm_free(ptr);
-}
-
-void * pvPortRealloc(void * ptr, size_t size) {
-    return (void*) umm_realloc(ptr, size);
-}
-
-size_t xPortWantedSizeAlign(size_t size) {
-    return (size + 3) & ~((size_t) 3);
-}
-
-#else
-
-void * pvPortRealloc(void *mem, size_t newsize) {
-    if (newsize == 0) {
-        vPortFree(mem);
-        return NULL;
-    }
-    void * p;
-    p = (void *) pvPortMalloc(newsize);
-    if (p) {
-        if (mem != NULL) {
-            memcpy(p, mem, newsize);
-            vPortFree(mem);
-        }
-    }
-    return p;
-}
-
-#endif
+void * pvPortMalloc(size_t size);
+void vPortFree(void * ptr);
+void * pvPortRealloc(void * ptr, size_t size);
 
 void * pvPortCalloc(size_t nelem, size_t elsize) {
     void * pvReturn = NULL;
     size_t len = nelem * elsize;
+    HEAP_TRACE_CALLER();
     pvReturn = (void*) pvPortMalloc(len);
     if (pvReturn != NULL)
         memset(pvReturn, 0, len);
@@ -57,10 +22,12 @@ void * pvPortCalloc(size_t nelem, size_t elsize) {
 }
 
 void *pvPortZalloc(size_t size) {
+    HEAP_TRACE_CALLER();
     return pvPortCalloc(1, size);
 }
 
 void * __wrap_malloc(size_t s) {
+    HEAP_TRACE_CALLER();
     return (void*) pvPortMalloc(s);
 }
 
@@ -68,11 +35,15 @@ void __wrap_free(void * ptr) {
     vPortFree(ptr);
 }
 
+void * realloc(void * ptr, size_t nbytes) {
+    HEAP_TRACE_CALLER();
+    return pvPortRealloc(ptr, nbytes); // heap_4.c or heap_umm.c
+}
+
 
 //void * malloc(size_t s)__attribute__((alias("pvPortMalloc")));
 //void free(void * ptr)__attribute__((alias("vPortFree")));
 
-void *realloc(void *ptr, size_t nbytes) __attribute__((alias("pvPortRealloc")));
 void *calloc(size_t count, size_t nbytes) __attribute__((alias("pvPortCalloc")));
 void *zalloc(size_t nbytes) __attribute__((alias("pvPortZalloc")));
 
@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=apps/app_http.c apps/app_ssl_selftest.c drivers/mrf24wn/mrf.c drivers/mrf24wn/mrf_hal.c drivers/mrf24wn/mrf_lib.c drivers/mrf24wn/mrf_osal.c drivers/mrf24wn/mrf_isr.S middleware/freertos/portable/MemMang/heap_4.c middleware/freertos/portable/MPLAB/PIC32MZ/port.c middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.S middleware/freertos/croutine.c middleware/freertos/event_groups.c middleware/freertos/list.c middleware/freertos/queue.c middleware/freertos/stream_buffer.c middleware/freertos/tasks.c middleware/freertos/timers.c middleware/http/httpclient.c middleware/lwip/api/api_lib.c middleware/lwip/api/api_msg.c middleware/lwip/api/err.c middleware/lwip/api/netbuf.c middleware/lwip/api/netdb.c middleware/lwip/api/netifapi.c middleware/lwip/api/sockets.c middleware/lwip/api/tcpip.c middleware/lwip/core/ipv4/autoip.c middleware/lwip/core/ipv4/dhcp.c middleware/lwip/core/ipv4/etharp.c middleware/lwip/core/ipv4/icmp.c middleware/lwip/core/ipv4/igmp.c middleware/lwip/core/ipv4/ip4.c middleware/lwip/core/ipv4/ip4_addr.c middleware/lwip/core/ipv4/ip4_frag.c middleware/lwip/core/ipv6/dhcp6.c middleware/lwip/core/ipv6/ethip6.c middleware/lwip/core/ipv6/icmp6.c middleware/lwip/core/ipv6/inet6.c middleware/lwip/core/ipv6/ip6.c middleware/lwip/core/ipv6/ip6_addr.c middleware/lwip/core/ipv6/ip6_frag.c middleware/lwip/core/ipv6/mld6.c middleware/lwip/core/ipv6/nd6.c middleware/lwip/core/def.c middleware/lwip/core/dns.c middleware/lwip/core/inet_chksum.c middleware/lwip/core/init.c middleware/lwip/core/ip.c middleware/lwip/core/mem.c middleware/lwip/core/memp.c middleware/lwip/core/netif.c middleware/lwip/core/pbuf.c middleware/lwip/core/raw.c middleware/lwip/core/stats.c middleware/lwip/core/sys.c middleware/lwip/core/tcp.c middleware/lwip/core/tcp_in.c middleware/lwip/core/tcp_out.c middleware/lwip/core/timeouts.c middleware/lwip/core/udp.c middleware/lwip/netif/ppp/polarssl/arc4.c middleware/lwip/netif/ppp/polarssl/des.c middleware/lwip/netif/ppp/polarssl/md4.c middleware/lwip/netif/ppp/polarssl/md5.c middleware/lwip/netif/ppp/polarssl/sha1.c middleware/lwip/netif/ppp/auth.c middleware/lwip/netif/ppp/ccp.c middleware/lwip/netif/ppp/chap-md5.c middleware/lwip/netif/ppp/chap-new.c middleware/lwip/netif/ppp/chap_ms.c middleware/lwip/netif/ppp/demand.c middleware/lwip/netif/ppp/eap.c middleware/lwip/netif/ppp/ecp.c middleware/lwip/netif/ppp/eui64.c middleware/lwip/netif/ppp/fsm.c middleware/lwip/netif/ppp/ipcp.c middleware/lwip/netif/ppp/ipv6cp.c middleware/lwip/netif/ppp/lcp.c middleware/lwip/netif/ppp/magic.c middleware/lwip/netif/ppp/mppe.c middleware/lwip/netif/ppp/multilink.c middleware/lwip/netif/ppp/ppp.c middleware/lwip/netif/ppp/pppapi.c middleware/lwip/netif/ppp/pppcrypt.c middleware/lwip/netif/ppp/pppoe.c middleware/lwip/netif/ppp/pppol2tp.c middleware/lwip/netif/ppp/pppos.c middleware/lwip/netif/ppp/upap.c middleware/lwip/netif/ppp/utils.c middleware/lwip/netif/ppp/vj.c middleware/lwip/netif/ethernet.c middleware/lwip/netif/ethernetif.c middleware/lwip/port/sys_arch.c middleware/mbedtls/port/pic32_crypto.c middleware/mbedtls/port/alt_md5.c middleware/mbedtls/port/alt_sha1.c middleware/mbedtls/port/alt_aes.c middleware/mbedtls/port/alt_des.c middleware/mbedtls/port/alt_sha256.c middleware/mbedtls/aes.c middleware/mbedtls/aesni.c middleware/mbedtls/arc4.c middleware/mbedtls/asn1parse.c middleware/mbedtls/asn1write.c middleware/mbedtls/base64.c middleware/mbedtls/bignum.c middleware/mbedtls/blowfish.c middleware/mbedtls/camellia.c middleware/mbedtls/ccm.c middleware/mbedtls/certs.c middleware/mbedtls/cipher.c middleware/mbedtls/cipher_wrap.c middleware/mbedtls/cmac.c middleware/mbedtls/ctr_drbg.c middleware/mbedtls/debug.c middleware/mbedtls/des.c middleware/mbedtls/dhm.c middleware/mbedtls/ecdh.c middleware/mbedtls/ecdsa.c middleware/mbedtls/ecjpake.c middleware/mbedtls/ecp.c middleware/mbedtls/ecp_curves.c middleware/mbedtls/entropy.c middleware/mbedtls/entropy_poll.c middleware/mbedtls/error.c middleware/mbedtls/gcm.c middleware/mbedtls/havege.c middleware/mbedtls/hmac_drbg.c middleware/mbedtls/md.c middleware/mbedtls/md2.c middleware/mbedtls/md4.c middleware/mbedtls/md5.c middleware/mbedtls/md_wrap.c middleware/mbedtls/memory_buffer_alloc.c middleware/mbedtls/net_sockets.c middleware/mbedtls/oid.c middleware/mbedtls/padlock.c middleware/mbedtls/pem.c middleware/mbedtls/pk.c middleware/mbedtls/pkcs11.c middleware/mbedtls/pkcs12.c middleware/mbedtls/pkcs5.c middleware/mbedtls/pkparse.c middleware/mbedtls/pkwrite.c middleware/mbedtls/pk_wrap.c middleware/mbedtls/platform.c middleware/mbedtls/ripemd160.c middleware/mbedtls/rsa.c middleware/mbedtls/sha1.c middleware/mbedtls/sha256.c middleware/mbedtls/sha512.c middleware/mbedtls/ssl_cache.c middleware/mbedtls/ssl_ciphersuites.c middleware/mbedtls/ssl_cli.c middleware/mbedtls/ssl_cookie.c middleware/mbedtls/ssl_srv.c middleware/mbedtls/ssl_ticket.c middleware/mbedtls/ssl_tls.c middleware/mbedtls/threading.c middleware/mbedtls/timing.c middleware/mbedtls/version.c middleware/mbedtls/version_features.c middleware/mbedtls/x509.c middleware/mbedtls/x509write_crt.c middleware/mbedtls/x509write_csr.c middleware/mbedtls/x509_create.c middleware/mbedtls/x509_crl.c middleware/mbedtls/x509_crt.c middleware/mbedtls/x509_csr.c middleware/mbedtls/xtea.c middleware/wizio/freertos_common.c middleware/wizio/wrap_mem.c middleware/wizio/osal.c sys/sys.c sys/sys_common.c sys/sys_config.c sys/sys_rtcc.c sys/sys_trap.c sys/sys_log.c main.c
+SOURCEFILES_QUOTED_IF_SPACED=apps/app_http.c apps/app_bench.c apps/app_ssl_selftest.c drivers/mrf24wn/mrf.c drivers/mrf24wn/mrf_hal.c drivers/mrf24wn/mrf_lib.c drivers/mrf24wn/mrf_filter.c drivers/mrf24wn/mrf_osal.c drivers/mrf24wn/mrf_isr.S sys/sys_log_isr.S sys/sys_hrtimer_isr.S middleware/freertos/portable/MemMang/heap_4.c middleware/freertos/portable/MemMang/umm_malloc.c middleware/freertos/portable/MemMang/heap_umm.c middleware/freertos/portable/MPLAB/PIC32MZ/port.c middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.S middleware/freertos/croutine.c middleware/freertos/event_groups.c middleware/freertos/list.c middleware/freertos/queue.c middleware/freertos/stream_buffer.c middleware/freertos/tasks.c middleware/freertos/timers.c middleware/http/httpclient.c middleware/lwip/api/api_lib.c middleware/lwip/api/api_msg.c middleware/lwip/api/err.c middleware/lwip/api/netbuf.c middleware/lwip/api/netdb.c middleware/lwip/api/netifapi.c middleware/lwip/api/sockets.c middleware/lwip/api/tcpip.c middleware/lwip/core/ipv4/autoip.c middleware/lwip/core/ipv4/dhcp.c middleware/lwip/core/ipv4/etharp.c middleware/lwip/core/ipv4/icmp.c middleware/lwip/core/ipv4/igmp.c middleware/lwip/core/ipv4/ip4.c middleware/lwip/core/ipv4/ip4_addr.c middleware/lwip/core/ipv4/ip4_frag.c middleware/lwip/core/ipv6/dhcp6.c middleware/lwip/core/ipv6/ethip6.c middleware/lwip/core/ipv6/icmp6.c middleware/lwip/core/ipv6/inet6.c middleware/lwip/core/ipv6/ip6.c middleware/lwip/core/ipv6/ip6_addr.c middleware/lwip/core/ipv6/ip6_frag.c middleware/lwip/core/ipv6/mld6.c middleware/lwip/core/ipv6/nd6.c middleware/lwip/core/def.c middleware/lwip/core/dns.c middleware/lwip/core/inet_chksum.c middleware/lwip/core/init.c middleware/lwip/core/ip.c middleware/lwip/core/mem.c middleware/lwip/core/memp.c middleware/lwip/core/netif.c middleware/lwip/core/pbuf.c middleware/lwip/core/raw.c middleware/lwip/core/stats.c middleware/lwip/core/sys.c middleware/lwip/core/tcp.c middleware/lwip/core/tcp_in.c middleware/lwip/core/tcp_out.c middleware/lwip/core/timeouts.c middleware/lwip/core/udp.c middleware/lwip/netif/ppp/polarssl/arc4.c middleware/lwip/netif/ppp/polarssl/des.c middleware/lwip/netif/ppp/polarssl/md4.c middleware/lwip/netif/ppp/polarssl/md5.c middleware/lwip/netif/ppp/polarssl/sha1.c middleware/lwip/netif/ppp/auth.c middleware/lwip/netif/ppp/ccp.c middleware/lwip/netif/ppp/chap-md5.c middleware/lwip/netif/ppp/chap-new.c middleware/lwip/netif/ppp/chap_ms.c middleware/lwip/netif/ppp/demand.c middleware/lwip/netif/ppp/eap.c middleware/lwip/netif/ppp/ecp.c middleware/lwip/netif/ppp/eui64.c middleware/lwip/netif/ppp/fsm.c middleware/lwip/netif/ppp/ipcp.c middleware/lwip/netif/ppp/ipv6cp.c middleware/lwip/netif/ppp/lcp.c middleware/lwip/netif/ppp/magic.c middleware/lwip/netif/ppp/mppe.c middleware/lwip/netif/ppp/multilink.c middleware/lwip/netif/ppp/ppp.c middleware/lwip/netif/ppp/pppapi.c middleware/lwip/netif/ppp/pppcrypt.c middleware/lwip/netif/ppp/pppoe.c middleware/lwip/netif/ppp/pppol2tp.c middleware/lwip/netif/ppp/pppos.c middleware/lwip/netif/ppp/upap.c middleware/lwip/netif/ppp/utils.c middleware/lwip/netif/ppp/vj.c middleware/lwip/netif/ethernet.c middleware/lwip/netif/ethernetif.c middleware/lwip/port/sys_arch.c middleware/mbedtls/port/pic32_crypto.c middleware/mbedtls/port/tls_arena.c middleware/mbedtls/port/alt_md5.c middleware/mbedtls/port/alt_sha1.c middleware/mbedtls/port/alt_aes.c middleware/mbedtls/port/alt_des.c middleware/mbedtls/port/alt_sha256.c middleware/mbedtls/aes.c middleware/mbedtls/aesni.c middleware/mbedtls/arc4.c middleware/mbedtls/asn1parse.c middleware/mbedtls/asn1write.c middleware/mbedtls/base64.c middleware/mbedtls/bignum.c middleware/mbedtls/blowfish.c middleware/mbedtls/camellia.c middleware/mbedtls/ccm.c middleware/mbedtls/certs.c middleware/mbedtls/cipher.c middleware/mbedtls/cipher_wrap.c middleware/mbedtls/cmac.c middleware/mbedtls/ctr_drbg.c middleware/mbedtls/debug.c middleware/mbedtls/des.c middleware/mbedtls/dhm.c middleware/mbedtls/ecdh.c middleware/mbedtls/ecdsa.c middleware/mbedtls/ecjpake.c middleware/mbedtls/ecp.c middleware/mbedtls/ecp_curves.c middleware/mbedtls/entropy.c middleware/mbedtls/entropy_poll.c middleware/mbedtls/error.c middleware/mbedtls/gcm.c middleware/mbedtls/havege.c middleware/mbedtls/hmac_drbg.c middleware/mbedtls/md.c middleware/mbedtls/md2.c middleware/mbedtls/md4.c middleware/mbedtls/md5.c middleware/mbedtls/md_wrap.c middleware/mbedtls/memory_buffer_alloc.c middleware/mbedtls/net_sockets.c middleware/mbedtls/oid.c middleware/mbedtls/padlock.c middleware/mbedtls/pem.c middleware/mbedtls/pk.c middleware/mbedtls/pkcs11.c middleware/mbedtls/pkcs12.c middleware/mbedtls/pkcs5.c middleware/mbedtls/pkparse.c middleware/mbedtls/pkwrite.c middleware/mbedtls/pk_wrap.c middleware/mbedtls/platform.c middleware/mbedtls/ripemd160.c middleware/mbedtls/rsa.c middleware/mbedtls/sha1.c middleware/mbedtls/sha256.c middleware/mbedtls/sha512.c middleware/mbedtls/ssl_cache.c middleware/mbedtls/ssl_ciphersuites.c middleware/mbedtls/ssl_cli.c middleware/mbedtls/ssl_cookie.c middleware/mbedtls/ssl_srv.c middleware/mbedtls/ssl_ticket.c middleware/mbedtls/ssl_tls.c middleware/mbedtls/threading.c middleware/mbedtls/timing.c middleware/mbedtls/version.c middleware/mbedtls/version_features.c middleware/mbedtls/x509.c middleware/mbedtls/x509write_crt.c middleware/mbedtls/x509write_csr.c middleware/mbedtls/x509_create.c middleware/mbedtls/x509_crl.c middleware/mbedtls/x509_crt.c middleware/mbedtls/x509_csr.c middleware/mbedtls/xtea.c middleware/wizio/freertos_common.c middleware/wizio/wrap_mem.c middleware/wizio/slab.c middleware/wizio/rtos_static.c middleware/wizio/mpsc.c middleware/wizio/nsem.c middleware/wizio/coro.c middleware/wizio/twheel.c middleware/wizio/cpu_stats.c middleware/wizio/stack_mon.c middleware/wizio/trace_rec.c middleware/wizio/heap_trace.c middleware/wizio/osal.c sys/sys.c sys/sys_common.c sys/sys_config.c sys/sys_rtcc.c sys/sys_trap.c sys/sys_log.c sys/sys_hrtimer.c main.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/apps/app_http.o ${OBJECTDIR}/apps/app_ssl_selftest.o ${OBJECTDIR}/drivers/mrf24wn/mrf.o ${OBJECTDIR}/drivers/mrf24wn/mrf_hal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o ${OBJECTDIR}/middleware/freertos/croutine.o ${OBJECTDIR}/middleware/freertos/event_groups.o ${OBJECTDIR}/middleware/freertos/list.o ${OBJECTDIR}/middleware/freertos/queue.o ${OBJECTDIR}/middleware/freertos/stream_buffer.o ${OBJECTDIR}/middleware/freertos/tasks.o ${OBJECTDIR}/middleware/freertos/timers.o ${OBJECTDIR}/middleware/http/httpclient.o ${OBJECTDIR}/middleware/lwip/api/api_lib.o ${OBJECTDIR}/middleware/lwip/api/api_msg.o ${OBJECTDIR}/middleware/lwip/api/err.o ${OBJECTDIR}/middleware/lwip/api/netbuf.o ${OBJECTDIR}/middleware/lwip/api/netdb.o ${OBJECTDIR}/middleware/lwip/api/netifapi.o ${OBJECTDIR}/middleware/lwip/api/sockets.o ${OBJECTDIR}/middleware/lwip/api/tcpip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/autoip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/dhcp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/etharp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/icmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/igmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/dhcp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ethip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/icmp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/inet6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/mld6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/nd6.o ${OBJECTDIR}/middleware/lwip/core/def.o ${OBJECTDIR}/middleware/lwip/core/dns.o ${OBJECTDIR}/middleware/lwip/core/inet_chksum.o ${OBJECTDIR}/middleware/lwip/core/init.o ${OBJECTDIR}/middleware/lwip/core/ip.o ${OBJECTDIR}/middleware/lwip/core/mem.o ${OBJECTDIR}/middleware/lwip/core/memp.o ${OBJECTDIR}/middleware/lwip/core/netif.o ${OBJECTDIR}/middleware/lwip/core/pbuf.o ${OBJECTDIR}/middleware/lwip/core/raw.o ${OBJECTDIR}/middleware/lwip/core/stats.o ${OBJECTDIR}/middleware/lwip/core/sys.o ${OBJECTDIR}/middleware/lwip/core/tcp.o ${OBJECTDIR}/middleware/lwip/core/tcp_in.o ${OBJECTDIR}/middleware/lwip/core/tcp_out.o ${OBJECTDIR}/middleware/lwip/core/timeouts.o ${OBJECTDIR}/middleware/lwip/core/udp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/arc4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/des.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/sha1.o ${OBJECTDIR}/middleware/lwip/netif/ppp/auth.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ccp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-new.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap_ms.o ${OBJECTDIR}/middleware/lwip/netif/ppp/demand.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ecp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eui64.o ${OBJECTDIR}/middleware/lwip/netif/ppp/fsm.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipv6cp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/lcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/magic.o ${OBJECTDIR}/middleware/lwip/netif/ppp/mppe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/multilink.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ppp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppapi.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppcrypt.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppoe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppol2tp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppos.o ${OBJECTDIR}/middleware/lwip/netif/ppp/upap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/utils.o ${OBJECTDIR}/middleware/lwip/netif/ppp/vj.o ${OBJECTDIR}/middleware/lwip/netif/ethernet.o ${OBJECTDIR}/middleware/lwip/netif/ethernetif.o ${OBJECTDIR}/middleware/lwip/port/sys_arch.o ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha1.o ${OBJECTDIR}/middleware/mbedtls/port/alt_aes.o ${OBJECTDIR}/middleware/mbedtls/port/alt_des.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha256.o ${OBJECTDIR}/middleware/mbedtls/aes.o ${OBJECTDIR}/middleware/mbedtls/aesni.o ${OBJECTDIR}/middleware/mbedtls/arc4.o ${OBJECTDIR}/middleware/mbedtls/asn1parse.o ${OBJECTDIR}/middleware/mbedtls/asn1write.o ${OBJECTDIR}/middleware/mbedtls/base64.o ${OBJECTDIR}/middleware/mbedtls/bignum.o ${OBJECTDIR}/middleware/mbedtls/blowfish.o ${OBJECTDIR}/middleware/mbedtls/camellia.o ${OBJECTDIR}/middleware/mbedtls/ccm.o ${OBJECTDIR}/middleware/mbedtls/certs.o ${OBJECTDIR}/middleware/mbedtls/cipher.o ${OBJECTDIR}/middleware/mbedtls/cipher_wrap.o ${OBJECTDIR}/middleware/mbedtls/cmac.o ${OBJECTDIR}/middleware/mbedtls/ctr_drbg.o ${OBJECTDIR}/middleware/mbedtls/debug.o ${OBJECTDIR}/middleware/mbedtls/des.o ${OBJECTDIR}/middleware/mbedtls/dhm.o ${OBJECTDIR}/middleware/mbedtls/ecdh.o ${OBJECTDIR}/middleware/mbedtls/ecdsa.o ${OBJECTDIR}/middleware/mbedtls/ecjpake.o ${OBJECTDIR}/middleware/mbedtls/ecp.o ${OBJECTDIR}/middleware/mbedtls/ecp_curves.o ${OBJECTDIR}/middleware/mbedtls/entropy.o ${OBJECTDIR}/middleware/mbedtls/entropy_poll.o ${OBJECTDIR}/middleware/mbedtls/error.o ${OBJECTDIR}/middleware/mbedtls/gcm.o ${OBJECTDIR}/middleware/mbedtls/havege.o ${OBJECTDIR}/middleware/mbedtls/hmac_drbg.o ${OBJECTDIR}/middleware/mbedtls/md.o ${OBJECTDIR}/middleware/mbedtls/md2.o ${OBJECTDIR}/middleware/mbedtls/md4.o ${OBJECTDIR}/middleware/mbedtls/md5.o ${OBJECTDIR}/middleware/mbedtls/md_wrap.o ${OBJECTDIR}/middleware/mbedtls/memory_buffer_alloc.o ${OBJECTDIR}/middleware/mbedtls/net_sockets.o ${OBJECTDIR}/middleware/mbedtls/oid.o ${OBJECTDIR}/middleware/mbedtls/padlock.o ${OBJECTDIR}/middleware/mbedtls/pem.o ${OBJECTDIR}/middleware/mbedtls/pk.o ${OBJECTDIR}/middleware/mbedtls/pkcs11.o ${OBJECTDIR}/middleware/mbedtls/pkcs12.o ${OBJECTDIR}/middleware/mbedtls/pkcs5.o ${OBJECTDIR}/middleware/mbedtls/pkparse.o ${OBJECTDIR}/middleware/mbedtls/pkwrite.o ${OBJECTDIR}/middleware/mbedtls/pk_wrap.o ${OBJECTDIR}/middleware/mbedtls/platform.o ${OBJECTDIR}/middleware/mbedtls/ripemd160.o ${OBJECTDIR}/middleware/mbedtls/rsa.o ${OBJECTDIR}/middleware/mbedtls/sha1.o ${OBJECTDIR}/middleware/mbedtls/sha256.o ${OBJECTDIR}/middleware/mbedtls/sha512.o ${OBJECTDIR}/middleware/mbedtls/ssl_cache.o ${OBJECTDIR}/middleware/mbedtls/ssl_ciphersuites.o ${OBJECTDIR}/middleware/mbedtls/ssl_cli.o ${OBJECTDIR}/middleware/mbedtls/ssl_cookie.o ${OBJECTDIR}/middleware/mbedtls/ssl_srv.o ${OBJECTDIR}/middleware/mbedtls/ssl_ticket.o ${OBJECTDIR}/middleware/mbedtls/ssl_tls.o ${OBJECTDIR}/middleware/mbedtls/threading.o ${OBJECTDIR}/middleware/mbedtls/timing.o ${OBJECTDIR}/middleware/mbedtls/version.o ${OBJECTDIR}/middleware/mbedtls/version_features.o ${OBJECTDIR}/middleware/mbedtls/x509.o ${OBJECTDIR}/middleware/mbedtls/x509write_crt.o ${OBJECTDIR}/middleware/mbedtls/x509write_csr.o ${OBJECTDIR}/middleware/mbedtls/x509_create.o ${OBJECTDIR}/middleware/mbedtls/x509_crl.o ${OBJECTDIR}/middleware/mbedtls/x509_crt.o ${OBJECTDIR}/middleware/mbedtls/x509_csr.o ${OBJECTDIR}/middleware/mbedtls/xtea.o ${OBJECTDIR}/middleware/wizio/freertos_common.o ${OBJECTDIR}/middleware/wizio/wrap_mem.o ${OBJECTDIR}/middleware/wizio/osal.o ${OBJECTDIR}/sys/sys.o ${OBJECTDIR}/sys/sys_common.o ${OBJECTDIR}/sys/sys_config.o ${OBJECTDIR}/sys/sys_rtcc.o ${OBJECTDIR}/sys/sys_trap.o ${OBJECTDIR}/sys/sys_log.o ${OBJECTDIR}/main.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/apps/app_http.o.d ${OBJECTDIR}/apps/app_ssl_selftest.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_hal.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.d ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o.d ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o.d ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o.d ${OBJECTDIR}/middleware/freertos/croutine.o.d ${OBJECTDIR}/middleware/freertos/event_groups.o.d ${OBJECTDIR}/middleware/freertos/list.o.d ${OBJECTDIR}/middleware/freertos/queue.o.d ${OBJECTDIR}/middleware/freertos/stream_buffer.o.d ${OBJECTDIR}/middleware/freertos/tasks.o.d ${OBJECTDIR}/middleware/freertos/timers.o.d ${OBJECTDIR}/middleware/http/httpclient.o.d ${OBJECTDIR}/middleware/lwip/api/api_lib.o.d ${OBJECTDIR}/middleware/lwip/api/api_msg.o.d ${OBJECTDIR}/middleware/lwip/api/err.o.d ${OBJECTDIR}/middleware/lwip/api/netbuf.o.d ${OBJECTDIR}/middleware/lwip/api/netdb.o.d ${OBJECTDIR}/middleware/lwip/api/netifapi.o.d ${OBJECTDIR}/middleware/lwip/api/sockets.o.d ${OBJECTDIR}/middleware/lwip/api/tcpip.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/autoip.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/dhcp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/etharp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/icmp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/igmp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_addr.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_frag.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/dhcp6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ethip6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/icmp6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/inet6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_addr.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_frag.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/mld6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/nd6.o.d ${OBJECTDIR}/middleware/lwip/core/def.o.d ${OBJECTDIR}/middleware/lwip/core/dns.o.d ${OBJECTDIR}/middleware/lwip/core/inet_chksum.o.d ${OBJECTDIR}/middleware/lwip/core/init.o.d ${OBJECTDIR}/middleware/lwip/core/ip.o.d ${OBJECTDIR}/middleware/lwip/core/mem.o.d ${OBJECTDIR}/middleware/lwip/core/memp.o.d ${OBJECTDIR}/middleware/lwip/core/netif.o.d ${OBJECTDIR}/middleware/lwip/core/pbuf.o.d ${OBJECTDIR}/middleware/lwip/core/raw.o.d ${OBJECTDIR}/middleware/lwip/core/stats.o.d ${OBJECTDIR}/middleware/lwip/core/sys.o.d ${OBJECTDIR}/middleware/lwip/core/tcp.o.d ${OBJECTDIR}/middleware/lwip/core/tcp_in.o.d ${OBJECTDIR}/middleware/lwip/core/tcp_out.o.d ${OBJECTDIR}/middleware/lwip/core/timeouts.o.d ${OBJECTDIR}/middleware/lwip/core/udp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/arc4.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/des.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md4.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md5.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/sha1.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/auth.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ccp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-md5.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-new.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/chap_ms.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/demand.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/eap.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ecp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/eui64.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/fsm.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ipcp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ipv6cp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/lcp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/magic.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/mppe.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/multilink.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ppp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppapi.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppcrypt.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppoe.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppol2tp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppos.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/upap.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/utils.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/vj.o.d ${OBJECTDIR}/middleware/lwip/netif/ethernet.o.d ${OBJECTDIR}/middleware/lwip/netif/ethernetif.o.d ${OBJECTDIR}/middleware/lwip/port/sys_arch.o.d ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_sha1.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_aes.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_des.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_sha256.o.d ${OBJECTDIR}/middleware/mbedtls/aes.o.d ${OBJECTDIR}/middleware/mbedtls/aesni.o.d ${OBJECTDIR}/middleware/mbedtls/arc4.o.d ${OBJECTDIR}/middleware/mbedtls/asn1parse.o.d ${OBJECTDIR}/middleware/mbedtls/asn1write.o.d ${OBJECTDIR}/middleware/mbedtls/base64.o.d ${OBJECTDIR}/middleware/mbedtls/bignum.o.d ${OBJECTDIR}/middleware/mbedtls/blowfish.o.d ${OBJECTDIR}/middleware/mbedtls/camellia.o.d ${OBJECTDIR}/middleware/mbedtls/ccm.o.d ${OBJECTDIR}/middleware/mbedtls/certs.o.d ${OBJECTDIR}/middleware/mbedtls/cipher.o.d ${OBJECTDIR}/middleware/mbedtls/cipher_wrap.o.d ${OBJECTDIR}/middleware/mbedtls/cmac.o.d ${OBJECTDIR}/middleware/mbedtls/ctr_drbg.o.d ${OBJECTDIR}/middleware/mbedtls/debug.o.d ${OBJECTDIR}/middleware/mbedtls/des.o.d ${OBJECTDIR}/middleware/mbedtls/dhm.o.d ${OBJECTDIR}/middleware/mbedtls/ecdh.o.d ${OBJECTDIR}/middleware/mbedtls/ecdsa.o.d ${OBJECTDIR}/middleware/mbedtls/ecjpake.o.d ${OBJECTDIR}/middleware/mbedtls/ecp.o.d ${OBJECTDIR}/middleware/mbedtls/ecp_curves.o.d ${OBJECTDIR}/middleware/mbedtls/entropy.o.d ${OBJECTDIR}/middleware/mbedtls/entropy_poll.o.d ${OBJECTDIR}/middleware/mbedtls/error.o.d ${OBJECTDIR}/middleware/mbedtls/gcm.o.d ${OBJECTDIR}/middleware/mbedtls/havege.o.d ${OBJECTDIR}/middleware/mbedtls/hmac_drbg.o.d ${OBJECTDIR}/middleware/mbedtls/md.o.d ${OBJECTDIR}/middleware/mbedtls/md2.o.d ${OBJECTDIR}/middleware/mbedtls/md4.o.d ${OBJECTDIR}/middleware/mbedtls/md5.o.d ${OBJECTDIR}/middleware/mbedtls/md_wrap.o.d ${OBJECTDIR}/middleware/mbedtls/memory_buffer_alloc.o.d ${OBJECTDIR}/middleware/mbedtls/net_sockets.o.d ${OBJECTDIR}/middleware/mbedtls/oid.o.d ${OBJECTDIR}/middleware/mbedtls/padlock.o.d ${OBJECTDIR}/middleware/mbedtls/pem.o.d ${OBJECTDIR}/middleware/mbedtls/pk.o.d ${OBJECTDIR}/middleware/mbedtls/pkcs11.o.d ${OBJECTDIR}/middleware/mbedtls/pkcs12.o.d ${OBJECTDIR}/middleware/mbedtls/pkcs5.o.d ${OBJECTDIR}/middleware/mbedtls/pkparse.o.d ${OBJECTDIR}/middleware/mbedtls/pkwrite.o.d ${OBJECTDIR}/middleware/mbedtls/pk_wrap.o.d ${OBJECTDIR}/middleware/mbedtls/platform.o.d ${OBJECTDIR}/middleware/mbedtls/ripemd160.o.d ${OBJECTDIR}/middleware/mbedtls/rsa.o.d ${OBJECTDIR}/middleware/mbedtls/sha1.o.d ${OBJECTDIR}/middleware/mbedtls/sha256.o.d ${OBJECTDIR}/middleware/mbedtls/sha512.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_cache.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_ciphersuites.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_cli.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_cookie.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_srv.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_ticket.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_tls.o.d ${OBJECTDIR}/middleware/mbedtls/threading.o.d ${OBJECTDIR}/middleware/mbedtls/timing.o.d ${OBJECTDIR}/middleware/mbedtls/version.o.d ${OBJECTDIR}/middleware/mbedtls/version_features.o.d ${OBJECTDIR}/middleware/mbedtls/x509.o.d ${OBJECTDIR}/middleware/mbedtls/x509write_crt.o.d ${OBJECTDIR}/middleware/mbedtls/x509write_csr.o.d ${OBJECTDIR}/middleware/mbedtls/x509_create.o.d ${OBJECTDIR}/middleware/mbedtls/x509_crl.o.d ${OBJECTDIR}/middleware/mbedtls/x509_crt.o.d ${OBJECTDIR}/middleware/mbedtls/x509_csr.o.d ${OBJECTDIR}/middleware/mbedtls/xtea.o.d ${OBJECTDIR}/middleware/wizio/freertos_common.o.d ${OBJECTDIR}/middleware/wizio/wrap_mem.o.d ${OBJECTDIR}/middleware/wizio/osal.o.d ${OBJECTDIR}/sys/sys.o.d ${OBJECTDIR}/sys/sys_common.o.d ${OBJECTDIR}/sys/sys_config.o.d ${OBJECTDIR}/sys/sys_rtcc.o.d ${OBJECTDIR}/sys/sys_trap.o.d ${OBJECTDIR}/sys/sys_log.o.d ${OBJECTDIR}/main.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/apps/app_http.o ${OBJECTDIR}/apps/app_bench.o ${OBJECTDIR}/apps/app_ssl_selftest.o ${OBJECTDIR}/drivers/mrf24wn/mrf.o ${OBJECTDIR}/drivers/mrf24wn/mrf_hal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o ${OBJECTDIR}/sys/sys_log_isr.o ${OBJECTDIR}/sys/sys_hrtimer_isr.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o ${OBJECTDIR}/middleware/freertos/croutine.o ${OBJECTDIR}/middleware/freertos/event_groups.o ${OBJECTDIR}/middleware/freertos/list.o ${OBJECTDIR}/middleware/freertos/queue.o ${OBJECTDIR}/middleware/freertos/stream_buffer.o ${OBJECTDIR}/middleware/freertos/tasks.o ${OBJECTDIR}/middleware/freertos/timers.o ${OBJECTDIR}/middleware/http/httpclient.o ${OBJECTDIR}/middleware/lwip/api/api_lib.o ${OBJECTDIR}/middleware/lwip/api/api_msg.o ${OBJECTDIR}/middleware/lwip/api/err.o ${OBJECTDIR}/middleware/lwip/api/netbuf.o ${OBJECTDIR}/middleware/lwip/api/netdb.o ${OBJECTDIR}/middleware/lwip/api/netifapi.o ${OBJECTDIR}/middleware/lwip/api/sockets.o ${OBJECTDIR}/middleware/lwip/api/tcpip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/autoip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/dhcp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/etharp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/icmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/igmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/dhcp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ethip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/icmp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/inet6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/mld6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/nd6.o ${OBJECTDIR}/middleware/lwip/core/def.o ${OBJECTDIR}/middleware/lwip/core/dns.o ${OBJECTDIR}/middleware/lwip/core/inet_chksum.o ${OBJECTDIR}/middleware/lwip/core/init.o ${OBJECTDIR}/middleware/lwip/core/ip.o ${OBJECTDIR}/middleware/lwip/core/mem.o ${OBJECTDIR}/middleware/lwip/core/memp.o ${OBJECTDIR}/middleware/lwip/core/netif.o ${OBJECTDIR}/middleware/lwip/core/pbuf.o ${OBJECTDIR}/middleware/lwip/core/raw.o ${OBJECTDIR}/middleware/lwip/core/stats.o ${OBJECTDIR}/middleware/lwip/core/sys.o ${OBJECTDIR}/middleware/lwip/core/tcp.o ${OBJECTDIR}/middleware/lwip/core/tcp_in.o ${OBJECTDIR}/middleware/lwip/core/tcp_out.o ${OBJECTDIR}/middleware/lwip/core/timeouts.o ${OBJECTDIR}/middleware/lwip/core/udp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/arc4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/des.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/sha1.o ${OBJECTDIR}/middleware/lwip/netif/ppp/auth.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ccp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-new.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap_ms.o ${OBJECTDIR}/middleware/lwip/netif/ppp/demand.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ecp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eui64.o ${OBJECTDIR}/middleware/lwip/netif/ppp/fsm.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipv6cp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/lcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/magic.o ${OBJECTDIR}/middleware/lwip/netif/ppp/mppe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/multilink.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ppp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppapi.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppcrypt.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppoe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppol2tp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppos.o ${OBJECTDIR}/middleware/lwip/netif/ppp/upap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/utils.o ${OBJECTDIR}/middleware/lwip/netif/ppp/vj.o ${OBJECTDIR}/middleware/lwip/netif/ethernet.o ${OBJECTDIR}/middleware/lwip/netif/ethernetif.o ${OBJECTDIR}/middleware/lwip/port/sys_arch.o ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha1.o ${OBJECTDIR}/middleware/mbedtls/port/alt_aes.o ${OBJECTDIR}/middleware/mbedtls/port/alt_des.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha256.o ${OBJECTDIR}/middleware/mbedtls/aes.o ${OBJECTDIR}/middleware/mbedtls/aesni.o ${OBJECTDIR}/middleware/mbedtls/arc4.o ${OBJECTDIR}/middleware/mbedtls/asn1parse.o ${OBJECTDIR}/middleware/mbedtls/asn1write.o ${OBJECTDIR}/middleware/mbedtls/base64.o ${OBJECTDIR}/middleware/mbedtls/bignum.o ${OBJECTDIR}/middleware/mbedtls/blowfish.o ${OBJECTDIR}/middleware/mbedtls/camellia.o ${OBJECTDIR}/middleware/mbedtls/ccm.o ${OBJECTDIR}/middleware/mbedtls/certs.o ${OBJECTDIR}/middleware/mbedtls/cipher.o ${OBJECTDIR}/middleware/mbedtls/cipher_wrap.o ${OBJECTDIR}/middleware/mbedtls/cmac.o ${OBJECTDIR}/middleware/mbedtls/ctr_drbg.o ${OBJECTDIR}/middleware/mbedtls/debug.o ${OBJECTDIR}/middleware/mbedtls/des.o ${OBJECTDIR}/middleware/mbedtls/dhm.o ${OBJECTDIR}/middleware/mbedtls/ecdh.o ${OBJECTDIR}/middleware/mbedtls/ecdsa.o ${OBJECTDIR}/middleware/mbedtls/ecjpake.o ${OBJECTDIR}/middleware/mbedtls/ecp.o ${OBJECTDIR}/middleware/mbedtls/ecp_curves.o ${OBJECTDIR}/middleware/mbedtls/entropy.o ${OBJECTDIR}/middleware/mbedtls/entropy_poll.o ${OBJECTDIR}/middleware/mbedtls/error.o ${OBJECTDIR}/middleware/mbedtls/gcm.o ${OBJECTDIR}/middleware/mbedtls/havege.o ${OBJECTDIR}/middleware/mbedtls/hmac_drbg.o ${OBJECTDIR}/middleware/mbedtls/md.o ${OBJECTDIR}/middleware/mbedtls/md2.o ${OBJECTDIR}/middleware/mbedtls/md4.o ${OBJECTDIR}/middleware/mbedtls/md5.o ${OBJECTDIR}/middleware/mbedtls/md_wrap.o ${OBJECTDIR}/middleware/mbedtls/memory_buffer_alloc.o ${OBJECTDIR}/middleware/mbedtls/net_sockets.o ${OBJECTDIR}/middleware/mbedtls/oid.o ${OBJECTDIR}/middleware/mbedtls/padlock.o ${OBJECTDIR}/middleware/mbedtls/pem.o ${OBJECTDIR}/middleware/mbedtls/pk.o ${OBJECTDIR}/middleware/mbedtls/pkcs11.o ${OBJECTDIR}/middleware/mbedtls/pkcs12.o ${OBJECTDIR}/middleware/mbedtls/pkcs5.o ${OBJECTDIR}/middleware/mbedtls/pkparse.o ${OBJECTDIR}/middleware/mbedtls/pkwrite.o ${OBJECTDIR}/middleware/mbedtls/pk_wrap.o ${OBJECTDIR}/middleware/mbedtls/platform.o ${OBJECTDIR}/middleware/mbedtls/ripemd160.o ${OBJECTDIR}/middleware/mbedtls/rsa.o ${OBJECTDIR}/middleware/mbedtls/sha1.o ${OBJECTDIR}/middleware/mbedtls/sha256.o ${OBJECTDIR}/middleware/mbedtls/sha512.o ${OBJECTDIR}/middleware/mbedtls/ssl_cache.o ${OBJECTDIR}/middleware/mbedtls/ssl_ciphersuites.o ${OBJECTDIR}/middleware/mbedtls/ssl_cli.o ${OBJECTDIR}/middleware/mbedtls/ssl_cookie.o ${OBJECTDIR}/middleware/mbedtls/ssl_srv.o ${OBJECTDIR}/middleware/mbedtls/ssl_ticket.o ${OBJECTDIR}/middleware/mbedtls/ssl_tls.o ${OBJECTDIR}/middleware/mbedtls/threading.o ${OBJECTDIR}/middleware/mbedtls/timing.o ${OBJECTDIR}/middleware/mbedtls/version.o ${OBJECTDIR}/middleware/mbedtls/version_features.o ${OBJECTDIR}/middleware/mbedtls/x509.o ${OBJECTDIR}/middleware/mbedtls/x509write_crt.o ${OBJECTDIR}/middleware/mbedtls/x509write_csr.o ${OBJECTDIR}/middleware/mbedtls/x509_create.o ${OBJECTDIR}/middleware/mbedtls/x509_crl.o ${OBJECTDIR}/middleware/mbedtls/x509_crt.o ${OBJECTDIR}/middleware/mbedtls/x509_csr.o ${OBJECTDIR}/middleware/mbedtls/xtea.o ${OBJECTDIR}/middleware/wizio/freertos_common.o ${OBJECTDIR}/middleware/wizio/wrap_mem.o ${OBJECTDIR}/middleware/wizio/slab.o ${OBJECTDIR}/middleware/wizio/rtos_static.o ${OBJECTDIR}/middleware/wizio/mpsc.o ${OBJECTDIR}/middleware/wizio/nsem.o ${OBJECTDIR}/middleware/wizio/coro.o ${OBJECTDIR}/middleware/wizio/twheel.o ${OBJECTDIR}/middleware/wizio/cpu_stats.o ${OBJECTDIR}/middleware/wizio/stack_mon.o ${OBJECTDIR}/middleware/wizio/trace_rec.o ${OBJECTDIR}/middleware/wizio/heap_trace.o ${OBJECTDIR}/middleware/wizio/osal.o ${OBJECTDIR}/sys/sys.o ${OBJECTDIR}/sys/sys_common.o ${OBJECTDIR}/sys/sys_config.o ${OBJECTDIR}/sys/sys_rtcc.o ${OBJECTDIR}/sys/sys_trap.o ${OBJECTDIR}/sys/sys_log.o ${OBJECTDIR}/sys/sys_hrtimer.o ${OBJECTDIR}/main.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/apps/app_http.o.d ${OBJECTDIR}/apps/app_bench.o.d ${OBJECTDIR}/apps/app_ssl_selftest.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_hal.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o.d ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.d ${OBJECTDIR}/sys/sys_log_isr.o.d ${OBJECTDIR}/sys/sys_hrtimer_isr.o.d ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o.d ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o.d ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o.d ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o.d ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o.d ${OBJECTDIR}/middleware/freertos/croutine.o.d ${OBJECTDIR}/middleware/freertos/event_groups.o.d ${OBJECTDIR}/middleware/freertos/list.o.d ${OBJECTDIR}/middleware/freertos/queue.o.d ${OBJECTDIR}/middleware/freertos/stream_buffer.o.d ${OBJECTDIR}/middleware/freertos/tasks.o.d ${OBJECTDIR}/middleware/freertos/timers.o.d ${OBJECTDIR}/middleware/http/httpclient.o.d ${OBJECTDIR}/middleware/lwip/api/api_lib.o.d ${OBJECTDIR}/middleware/lwip/api/api_msg.o.d ${OBJECTDIR}/middleware/lwip/api/err.o.d ${OBJECTDIR}/middleware/lwip/api/netbuf.o.d ${OBJECTDIR}/middleware/lwip/api/netdb.o.d ${OBJECTDIR}/middleware/lwip/api/netifapi.o.d ${OBJECTDIR}/middleware/lwip/api/sockets.o.d ${OBJECTDIR}/middleware/lwip/api/tcpip.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/autoip.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/dhcp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/etharp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/icmp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/igmp.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_addr.o.d ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_frag.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/dhcp6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ethip6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/icmp6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/inet6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_addr.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_frag.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/mld6.o.d ${OBJECTDIR}/middleware/lwip/core/ipv6/nd6.o.d ${OBJECTDIR}/middleware/lwip/core/def.o.d ${OBJECTDIR}/middleware/lwip/core/dns.o.d ${OBJECTDIR}/middleware/lwip/core/inet_chksum.o.d ${OBJECTDIR}/middleware/lwip/core/init.o.d ${OBJECTDIR}/middleware/lwip/core/ip.o.d ${OBJECTDIR}/middleware/lwip/core/mem.o.d ${OBJECTDIR}/middleware/lwip/core/memp.o.d ${OBJECTDIR}/middleware/lwip/core/netif.o.d ${OBJECTDIR}/middleware/lwip/core/pbuf.o.d ${OBJECTDIR}/middleware/lwip/core/raw.o.d ${OBJECTDIR}/middleware/lwip/core/stats.o.d ${OBJECTDIR}/middleware/lwip/core/sys.o.d ${OBJECTDIR}/middleware/lwip/core/tcp.o.d ${OBJECTDIR}/middleware/lwip/core/tcp_in.o.d ${OBJECTDIR}/middleware/lwip/core/tcp_out.o.d ${OBJECTDIR}/middleware/lwip/core/timeouts.o.d ${OBJECTDIR}/middleware/lwip/core/udp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/arc4.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/des.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md4.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md5.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/sha1.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/auth.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ccp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-md5.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-new.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/chap_ms.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/demand.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/eap.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ecp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/eui64.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/fsm.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ipcp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ipv6cp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/lcp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/magic.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/mppe.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/multilink.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/ppp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppapi.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppcrypt.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppoe.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppol2tp.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/pppos.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/upap.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/utils.o.d ${OBJECTDIR}/middleware/lwip/netif/ppp/vj.o.d ${OBJECTDIR}/middleware/lwip/netif/ethernet.o.d ${OBJECTDIR}/middleware/lwip/netif/ethernetif.o.d ${OBJECTDIR}/middleware/lwip/port/sys_arch.o.d ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o.d ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_sha1.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_aes.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_des.o.d ${OBJECTDIR}/middleware/mbedtls/port/alt_sha256.o.d ${OBJECTDIR}/middleware/mbedtls/aes.o.d ${OBJECTDIR}/middleware/mbedtls/aesni.o.d ${OBJECTDIR}/middleware/mbedtls/arc4.o.d ${OBJECTDIR}/middleware/mbedtls/asn1parse.o.d ${OBJECTDIR}/middleware/mbedtls/asn1write.o.d ${OBJECTDIR}/middleware/mbedtls/base64.o.d ${OBJECTDIR}/middleware/mbedtls/bignum.o.d ${OBJECTDIR}/middleware/mbedtls/blowfish.o.d ${OBJECTDIR}/middleware/mbedtls/camellia.o.d ${OBJECTDIR}/middleware/mbedtls/ccm.o.d ${OBJECTDIR}/middleware/mbedtls/certs.o.d ${OBJECTDIR}/middleware/mbedtls/cipher.o.d ${OBJECTDIR}/middleware/mbedtls/cipher_wrap.o.d ${OBJECTDIR}/middleware/mbedtls/cmac.o.d ${OBJECTDIR}/middleware/mbedtls/ctr_drbg.o.d ${OBJECTDIR}/middleware/mbedtls/debug.o.d ${OBJECTDIR}/middleware/mbedtls/des.o.d ${OBJECTDIR}/middleware/mbedtls/dhm.o.d ${OBJECTDIR}/middleware/mbedtls/ecdh.o.d ${OBJECTDIR}/middleware/mbedtls/ecdsa.o.d ${OBJECTDIR}/middleware/mbedtls/ecjpake.o.d ${OBJECTDIR}/middleware/mbedtls/ecp.o.d ${OBJECTDIR}/middleware/mbedtls/ecp_curves.o.d ${OBJECTDIR}/middleware/mbedtls/entropy.o.d ${OBJECTDIR}/middleware/mbedtls/entropy_poll.o.d ${OBJECTDIR}/middleware/mbedtls/error.o.d ${OBJECTDIR}/middleware/mbedtls/gcm.o.d ${OBJECTDIR}/middleware/mbedtls/havege.o.d ${OBJECTDIR}/middleware/mbedtls/hmac_drbg.o.d ${OBJECTDIR}/middleware/mbedtls/md.o.d ${OBJECTDIR}/middleware/mbedtls/md2.o.d ${OBJECTDIR}/middleware/mbedtls/md4.o.d ${OBJECTDIR}/middleware/mbedtls/md5.o.d ${OBJECTDIR}/middleware/mbedtls/md_wrap.o.d ${OBJECTDIR}/middleware/mbedtls/memory_buffer_alloc.o.d ${OBJECTDIR}/middleware/mbedtls/net_sockets.o.d ${OBJECTDIR}/middleware/mbedtls/oid.o.d ${OBJECTDIR}/middleware/mbedtls/padlock.o.d ${OBJECTDIR}/middleware/mbedtls/pem.o.d ${OBJECTDIR}/middleware/mbedtls/pk.o.d ${OBJECTDIR}/middleware/mbedtls/pkcs11.o.d ${OBJECTDIR}/middleware/mbedtls/pkcs12.o.d ${OBJECTDIR}/middleware/mbedtls/pkcs5.o.d ${OBJECTDIR}/middleware/mbedtls/pkparse.o.d ${OBJECTDIR}/middleware/mbedtls/pkwrite.o.d ${OBJECTDIR}/middleware/mbedtls/pk_wrap.o.d ${OBJECTDIR}/middleware/mbedtls/platform.o.d ${OBJECTDIR}/middleware/mbedtls/ripemd160.o.d ${OBJECTDIR}/middleware/mbedtls/rsa.o.d ${OBJECTDIR}/middleware/mbedtls/sha1.o.d ${OBJECTDIR}/middleware/mbedtls/sha256.o.d ${OBJECTDIR}/middleware/mbedtls/sha512.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_cache.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_ciphersuites.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_cli.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_cookie.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_srv.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_ticket.o.d ${OBJECTDIR}/middleware/mbedtls/ssl_tls.o.d ${OBJECTDIR}/middleware/mbedtls/threading.o.d ${OBJECTDIR}/middleware/mbedtls/timing.o.d ${OBJECTDIR}/middleware/mbedtls/version.o.d ${OBJECTDIR}/middleware/mbedtls/version_features.o.d ${OBJECTDIR}/middleware/mbedtls/x509.o.d ${OBJECTDIR}/middleware/mbedtls/x509write_crt.o.d ${OBJECTDIR}/middleware/mbedtls/x509write_csr.o.d ${OBJECTDIR}/middleware/mbedtls/x509_create.o.d ${OBJECTDIR}/middleware/mbedtls/x509_crl.o.d ${OBJECTDIR}/middleware/mbedtls/x509_crt.o.d ${OBJECTDIR}/middleware/mbedtls/x509_csr.o.d ${OBJECTDIR}/middleware/mbedtls/xtea.o.d ${OBJECTDIR}/middleware/wizio/freertos_common.o.d ${OBJECTDIR}/middleware/wizio/wrap_mem.o.d ${OBJECTDIR}/middleware/wizio/slab.o.d ${OBJECTDIR}/middleware/wizio/rtos_static.o.d ${OBJECTDIR}/middleware/wizio/mpsc.o.d ${OBJECTDIR}/middleware/wizio/nsem.o.d ${OBJECTDIR}/middleware/wizio/coro.o.d ${OBJECTDIR}/middleware/wizio/twheel.o.d ${OBJECTDIR}/middleware/wizio/cpu_stats.o.d ${OBJECTDIR}/middleware/wizio/stack_mon.o.d ${OBJECTDIR}/middleware/wizio/trace_rec.o.d ${OBJECTDIR}/middleware/wizio/heap_trace.o.d ${OBJECTDIR}/middleware/wizio/osal.o.d ${OBJECTDIR}/sys/sys.o.d ${OBJECTDIR}/sys/sys_common.o.d ${OBJECTDIR}/sys/sys_config.o.d ${OBJECTDIR}/sys/sys_rtcc.o.d ${OBJECTDIR}/sys/sys_trap.o.d ${OBJECTDIR}/sys/sys_log.o.d ${OBJECTDIR}/sys/sys_hrtimer.o.d ${OBJECTDIR}/main.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/apps/app_http.o ${OBJECTDIR}/apps/app_ssl_selftest.o ${OBJECTDIR}/drivers/mrf24wn/mrf.o ${OBJECTDIR}/drivers/mrf24wn/mrf_hal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o ${OBJECTDIR}/middleware/freertos/croutine.o ${OBJECTDIR}/middleware/freertos/event_groups.o ${OBJECTDIR}/middleware/freertos/list.o ${OBJECTDIR}/middleware/freertos/queue.o ${OBJECTDIR}/middleware/freertos/stream_buffer.o ${OBJECTDIR}/middleware/freertos/tasks.o ${OBJECTDIR}/middleware/freertos/timers.o ${OBJECTDIR}/middleware/http/httpclient.o ${OBJECTDIR}/middleware/lwip/api/api_lib.o ${OBJECTDIR}/middleware/lwip/api/api_msg.o ${OBJECTDIR}/middleware/lwip/api/err.o ${OBJECTDIR}/middleware/lwip/api/netbuf.o ${OBJECTDIR}/middleware/lwip/api/netdb.o ${OBJECTDIR}/middleware/lwip/api/netifapi.o ${OBJECTDIR}/middleware/lwip/api/sockets.o ${OBJECTDIR}/middleware/lwip/api/tcpip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/autoip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/dhcp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/etharp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/icmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/igmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/dhcp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ethip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/icmp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/inet6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/mld6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/nd6.o ${OBJECTDIR}/middleware/lwip/core/def.o ${OBJECTDIR}/middleware/lwip/core/dns.o ${OBJECTDIR}/middleware/lwip/core/inet_chksum.o ${OBJECTDIR}/middleware/lwip/core/init.o ${OBJECTDIR}/middleware/lwip/core/ip.o ${OBJECTDIR}/middleware/lwip/core/mem.o ${OBJECTDIR}/middleware/lwip/core/memp.o ${OBJECTDIR}/middleware/lwip/core/netif.o ${OBJECTDIR}/middleware/lwip/core/pbuf.o ${OBJECTDIR}/middleware/lwip/core/raw.o ${OBJECTDIR}/middleware/lwip/core/stats.o ${OBJECTDIR}/middleware/lwip/core/sys.o ${OBJECTDIR}/middleware/lwip/core/tcp.o ${OBJECTDIR}/middleware/lwip/core/tcp_in.o ${OBJECTDIR}/middleware/lwip/core/tcp_out.o ${OBJECTDIR}/middleware/lwip/core/timeouts.o ${OBJECTDIR}/middleware/lwip/core/udp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/arc4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/des.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/sha1.o ${OBJECTDIR}/middleware/lwip/netif/ppp/auth.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ccp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-new.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap_ms.o ${OBJECTDIR}/middleware/lwip/netif/ppp/demand.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ecp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eui64.o ${OBJECTDIR}/middleware/lwip/netif/ppp/fsm.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipv6cp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/lcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/magic.o ${OBJECTDIR}/middleware/lwip/netif/ppp/mppe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/multilink.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ppp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppapi.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppcrypt.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppoe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppol2tp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppos.o ${OBJECTDIR}/middleware/lwip/netif/ppp/upap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/utils.o ${OBJECTDIR}/middleware/lwip/netif/ppp/vj.o ${OBJECTDIR}/middleware/lwip/netif/ethernet.o ${OBJECTDIR}/middleware/lwip/netif/ethernetif.o ${OBJECTDIR}/middleware/lwip/port/sys_arch.o ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha1.o ${OBJECTDIR}/middleware/mbedtls/port/alt_aes.o ${OBJECTDIR}/middleware/mbedtls/port/alt_des.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha256.o ${OBJECTDIR}/middleware/mbedtls/aes.o ${OBJECTDIR}/middleware/mbedtls/aesni.o ${OBJECTDIR}/middleware/mbedtls/arc4.o ${OBJECTDIR}/middleware/mbedtls/asn1parse.o ${OBJECTDIR}/middleware/mbedtls/asn1write.o ${OBJECTDIR}/middleware/mbedtls/base64.o ${OBJECTDIR}/middleware/mbedtls/bignum.o ${OBJECTDIR}/middleware/mbedtls/blowfish.o ${OBJECTDIR}/middleware/mbedtls/camellia.o ${OBJECTDIR}/middleware/mbedtls/ccm.o ${OBJECTDIR}/middleware/mbedtls/certs.o ${OBJECTDIR}/middleware/mbedtls/cipher.o ${OBJECTDIR}/middleware/mbedtls/cipher_wrap.o ${OBJECTDIR}/middleware/mbedtls/cmac.o ${OBJECTDIR}/middleware/mbedtls/ctr_drbg.o ${OBJECTDIR}/middleware/mbedtls/debug.o ${OBJECTDIR}/middleware/mbedtls/des.o ${OBJECTDIR}/middleware/mbedtls/dhm.o ${OBJECTDIR}/middleware/mbedtls/ecdh.o ${OBJECTDIR}/middleware/mbedtls/ecdsa.o ${OBJECTDIR}/middleware/mbedtls/ecjpake.o ${OBJECTDIR}/middleware/mbedtls/ecp.o ${OBJECTDIR}/middleware/mbedtls/ecp_curves.o ${OBJECTDIR}/middleware/mbedtls/entropy.o ${OBJECTDIR}/middleware/mbedtls/entropy_poll.o ${OBJECTDIR}/middleware/mbedtls/error.o ${OBJECTDIR}/middleware/mbedtls/gcm.o ${OBJECTDIR}/middleware/mbedtls/havege.o ${OBJECTDIR}/middleware/mbedtls/hmac_drbg.o ${OBJECTDIR}/middleware/mbedtls/md.o ${OBJECTDIR}/middleware/mbedtls/md2.o ${OBJECTDIR}/middleware/mbedtls/md4.o ${OBJECTDIR}/middleware/mbedtls/md5.o ${OBJECTDIR}/middleware/mbedtls/md_wrap.o ${OBJECTDIR}/middleware/mbedtls/memory_buffer_alloc.o ${OBJECTDIR}/middleware/mbedtls/net_sockets.o ${OBJECTDIR}/middleware/mbedtls/oid.o ${OBJECTDIR}/middleware/mbedtls/padlock.o ${OBJECTDIR}/middleware/mbedtls/pem.o ${OBJECTDIR}/middleware/mbedtls/pk.o ${OBJECTDIR}/middleware/mbedtls/pkcs11.o ${OBJECTDIR}/middleware/mbedtls/pkcs12.o ${OBJECTDIR}/middleware/mbedtls/pkcs5.o ${OBJECTDIR}/middleware/mbedtls/pkparse.o ${OBJECTDIR}/middleware/mbedtls/pkwrite.o ${OBJECTDIR}/middleware/mbedtls/pk_wrap.o ${OBJECTDIR}/middleware/mbedtls/platform.o ${OBJECTDIR}/middleware/mbedtls/ripemd160.o ${OBJECTDIR}/middleware/mbedtls/rsa.o ${OBJECTDIR}/middleware/mbedtls/sha1.o ${OBJECTDIR}/middleware/mbedtls/sha256.o ${OBJECTDIR}/middleware/mbedtls/sha512.o ${OBJECTDIR}/middleware/mbedtls/ssl_cache.o ${OBJECTDIR}/middleware/mbedtls/ssl_ciphersuites.o ${OBJECTDIR}/middleware/mbedtls/ssl_cli.o ${OBJECTDIR}/middleware/mbedtls/ssl_cookie.o ${OBJECTDIR}/middleware/mbedtls/ssl_srv.o ${OBJECTDIR}/middleware/mbedtls/ssl_ticket.o ${OBJECTDIR}/middleware/mbedtls/ssl_tls.o ${OBJECTDIR}/middleware/mbedtls/threading.o ${OBJECTDIR}/middleware/mbedtls/timing.o ${OBJECTDIR}/middleware/mbedtls/version.o ${OBJECTDIR}/middleware/mbedtls/version_features.o ${OBJECTDIR}/middleware/mbedtls/x509.o ${OBJECTDIR}/middleware/mbedtls/x509write_crt.o ${OBJECTDIR}/middleware/mbedtls/x509write_csr.o ${OBJECTDIR}/middleware/mbedtls/x509_create.o ${OBJECTDIR}/middleware/mbedtls/x509_crl.o ${OBJECTDIR}/middleware/mbedtls/x509_crt.o ${OBJECTDIR}/middleware/mbedtls/x509_csr.o ${OBJECTDIR}/middleware/mbedtls/xtea.o ${OBJECTDIR}/middleware/wizio/freertos_common.o ${OBJECTDIR}/middleware/wizio/wrap_mem.o ${OBJECTDIR}/middleware/wizio/osal.o ${OBJECTDIR}/sys/sys.o ${OBJECTDIR}/sys/sys_common.o ${OBJECTDIR}/sys/sys_config.o ${OBJECTDIR}/sys/sys_rtcc.o ${OBJECTDIR}/sys/sys_trap.o ${OBJECTDIR}/sys/sys_log.o ${OBJECTDIR}/main.o
+OBJECTFILES=${OBJECTDIR}/apps/app_http.o ${OBJECTDIR}/apps/app_bench.o ${OBJECTDIR}/apps/app_ssl_selftest.o ${OBJECTDIR}/drivers/mrf24wn/mrf.o ${OBJECTDIR}/drivers/mrf24wn/mrf_hal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o ${OBJECTDIR}/sys/sys_log_isr.o ${OBJECTDIR}/sys/sys_hrtimer_isr.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o ${OBJECTDIR}/middleware/freertos/croutine.o ${OBJECTDIR}/middleware/freertos/event_groups.o ${OBJECTDIR}/middleware/freertos/list.o ${OBJECTDIR}/middleware/freertos/queue.o ${OBJECTDIR}/middleware/freertos/stream_buffer.o ${OBJECTDIR}/middleware/freertos/tasks.o ${OBJECTDIR}/middleware/freertos/timers.o ${OBJECTDIR}/middleware/http/httpclient.o ${OBJECTDIR}/middleware/lwip/api/api_lib.o ${OBJECTDIR}/middleware/lwip/api/api_msg.o ${OBJECTDIR}/middleware/lwip/api/err.o ${OBJECTDIR}/middleware/lwip/api/netbuf.o ${OBJECTDIR}/middleware/lwip/api/netdb.o ${OBJECTDIR}/middleware/lwip/api/netifapi.o ${OBJECTDIR}/middleware/lwip/api/sockets.o ${OBJECTDIR}/middleware/lwip/api/tcpip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/autoip.o ${OBJECTDIR}/middleware/lwip/core/ipv4/dhcp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/etharp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/icmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/igmp.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv4/ip4_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/dhcp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ethip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/icmp6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/inet6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_addr.o ${OBJECTDIR}/middleware/lwip/core/ipv6/ip6_frag.o ${OBJECTDIR}/middleware/lwip/core/ipv6/mld6.o ${OBJECTDIR}/middleware/lwip/core/ipv6/nd6.o ${OBJECTDIR}/middleware/lwip/core/def.o ${OBJECTDIR}/middleware/lwip/core/dns.o ${OBJECTDIR}/middleware/lwip/core/inet_chksum.o ${OBJECTDIR}/middleware/lwip/core/init.o ${OBJECTDIR}/middleware/lwip/core/ip.o ${OBJECTDIR}/middleware/lwip/core/mem.o ${OBJECTDIR}/middleware/lwip/core/memp.o ${OBJECTDIR}/middleware/lwip/core/netif.o ${OBJECTDIR}/middleware/lwip/core/pbuf.o ${OBJECTDIR}/middleware/lwip/core/raw.o ${OBJECTDIR}/middleware/lwip/core/stats.o ${OBJECTDIR}/middleware/lwip/core/sys.o ${OBJECTDIR}/middleware/lwip/core/tcp.o ${OBJECTDIR}/middleware/lwip/core/tcp_in.o ${OBJECTDIR}/middleware/lwip/core/tcp_out.o ${OBJECTDIR}/middleware/lwip/core/timeouts.o ${OBJECTDIR}/middleware/lwip/core/udp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/arc4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/des.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md4.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/polarssl/sha1.o ${OBJECTDIR}/middleware/lwip/netif/ppp/auth.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ccp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-md5.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap-new.o ${OBJECTDIR}/middleware/lwip/netif/ppp/chap_ms.o ${OBJECTDIR}/middleware/lwip/netif/ppp/demand.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ecp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/eui64.o ${OBJECTDIR}/middleware/lwip/netif/ppp/fsm.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ipv6cp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/lcp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/magic.o ${OBJECTDIR}/middleware/lwip/netif/ppp/mppe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/multilink.o ${OBJECTDIR}/middleware/lwip/netif/ppp/ppp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppapi.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppcrypt.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppoe.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppol2tp.o ${OBJECTDIR}/middleware/lwip/netif/ppp/pppos.o ${OBJECTDIR}/middleware/lwip/netif/ppp/upap.o ${OBJECTDIR}/middleware/lwip/netif/ppp/utils.o ${OBJECTDIR}/middleware/lwip/netif/ppp/vj.o ${OBJECTDIR}/middleware/lwip/netif/ethernet.o ${OBJECTDIR}/middleware/lwip/netif/ethernetif.o ${OBJECTDIR}/middleware/lwip/port/sys_arch.o ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha1.o ${OBJECTDIR}/middleware/mbedtls/port/alt_aes.o ${OBJECTDIR}/middleware/mbedtls/port/alt_des.o ${OBJECTDIR}/middleware/mbedtls/port/alt_sha256.o ${OBJECTDIR}/middleware/mbedtls/aes.o ${OBJECTDIR}/middleware/mbedtls/aesni.o ${OBJECTDIR}/middleware/mbedtls/arc4.o ${OBJECTDIR}/middleware/mbedtls/asn1parse.o ${OBJECTDIR}/middleware/mbedtls/asn1write.o ${OBJECTDIR}/middleware/mbedtls/base64.o ${OBJECTDIR}/middleware/mbedtls/bignum.o ${OBJECTDIR}/middleware/mbedtls/blowfish.o ${OBJECTDIR}/middleware/mbedtls/camellia.o ${OBJECTDIR}/middleware/mbedtls/ccm.o ${OBJECTDIR}/middleware/mbedtls/certs.o ${OBJECTDIR}/middleware/mbedtls/cipher.o ${OBJECTDIR}/middleware/mbedtls/cipher_wrap.o ${OBJECTDIR}/middleware/mbedtls/cmac.o ${OBJECTDIR}/middleware/mbedtls/ctr_drbg.o ${OBJECTDIR}/middleware/mbedtls/debug.o ${OBJECTDIR}/middleware/mbedtls/des.o ${OBJECTDIR}/middleware/mbedtls/dhm.o ${OBJECTDIR}/middleware/mbedtls/ecdh.o ${OBJECTDIR}/middleware/mbedtls/ecdsa.o ${OBJECTDIR}/middleware/mbedtls/ecjpake.o ${OBJECTDIR}/middleware/mbedtls/ecp.o ${OBJECTDIR}/middleware/mbedtls/ecp_curves.o ${OBJECTDIR}/middleware/mbedtls/entropy.o ${OBJECTDIR}/middleware/mbedtls/entropy_poll.o ${OBJECTDIR}/middleware/mbedtls/error.o ${OBJECTDIR}/middleware/mbedtls/gcm.o ${OBJECTDIR}/middleware/mbedtls/havege.o ${OBJECTDIR}/middleware/mbedtls/hmac_drbg.o ${OBJECTDIR}/middleware/mbedtls/md.o ${OBJECTDIR}/middleware/mbedtls/md2.o ${OBJECTDIR}/middleware/mbedtls/md4.o ${OBJECTDIR}/middleware/mbedtls/md5.o ${OBJECTDIR}/middleware/mbedtls/md_wrap.o ${OBJECTDIR}/middleware/mbedtls/memory_buffer_alloc.o ${OBJECTDIR}/middleware/mbedtls/net_sockets.o ${OBJECTDIR}/middleware/mbedtls/oid.o ${OBJECTDIR}/middleware/mbedtls/padlock.o ${OBJECTDIR}/middleware/mbedtls/pem.o ${OBJECTDIR}/middleware/mbedtls/pk.o ${OBJECTDIR}/middleware/mbedtls/pkcs11.o ${OBJECTDIR}/middleware/mbedtls/pkcs12.o ${OBJECTDIR}/middleware/mbedtls/pkcs5.o ${OBJECTDIR}/middleware/mbedtls/pkparse.o ${OBJECTDIR}/middleware/mbedtls/pkwrite.o ${OBJECTDIR}/middleware/mbedtls/pk_wrap.o ${OBJECTDIR}/middleware/mbedtls/platform.o ${OBJECTDIR}/middleware/mbedtls/ripemd160.o ${OBJECTDIR}/middleware/mbedtls/rsa.o ${OBJECTDIR}/middleware/mbedtls/sha1.o ${OBJECTDIR}/middleware/mbedtls/sha256.o ${OBJECTDIR}/middleware/mbedtls/sha512.o ${OBJECTDIR}/middleware/mbedtls/ssl_cache.o ${OBJECTDIR}/middleware/mbedtls/ssl_ciphersuites.o ${OBJECTDIR}/middleware/mbedtls/ssl_cli.o ${OBJECTDIR}/middleware/mbedtls/ssl_cookie.o ${OBJECTDIR}/middleware/mbedtls/ssl_srv.o ${OBJECTDIR}/middleware/mbedtls/ssl_ticket.o ${OBJECTDIR}/middleware/mbedtls/ssl_tls.o ${OBJECTDIR}/middleware/mbedtls/threading.o ${OBJECTDIR}/middleware/mbedtls/timing.o ${OBJECTDIR}/middleware/mbedtls/version.o ${OBJECTDIR}/middleware/mbedtls/version_features.o ${OBJECTDIR}/middleware/mbedtls/x509.o ${OBJECTDIR}/middleware/mbedtls/x509write_crt.o ${OBJECTDIR}/middleware/mbedtls/x509write_csr.o ${OBJECTDIR}/middleware/mbedtls/x509_create.o ${OBJECTDIR}/middleware/mbedtls/x509_crl.o ${OBJECTDIR}/middleware/mbedtls/x509_crt.o ${OBJECTDIR}/middleware/mbedtls/x509_csr.o ${OBJECTDIR}/middleware/mbedtls/xtea.o ${OBJECTDIR}/middleware/wizio/freertos_common.o ${OBJECTDIR}/middleware/wizio/wrap_mem.o ${OBJECTDIR}/middleware/wizio/slab.o ${OBJECTDIR}/middleware/wizio/rtos_static.o ${OBJECTDIR}/middleware/wizio/mpsc.o ${OBJECTDIR}/middleware/wizio/nsem.o ${OBJECTDIR}/middleware/wizio/coro.o ${OBJECTDIR}/middleware/wizio/twheel.o ${OBJECTDIR}/middleware/wizio/cpu_stats.o ${OBJECTDIR}/middleware/wizio/stack_mon.o ${OBJECTDIR}/middleware/wizio/trace_rec.o ${OBJECTDIR}/middleware/wizio/heap_trace.o ${OBJECTDIR}/middleware/wizio/osal.o ${OBJECTDIR}/sys/sys.o ${OBJECTDIR}/sys/sys_common.o ${OBJECTDIR}/sys/sys_config.o ${OBJECTDIR}/sys/sys_rtcc.o ${OBJECTDIR}/sys/sys_trap.o ${OBJECTDIR}/sys/sys_log.o ${OBJECTDIR}/sys/sys_hrtimer.o ${OBJECTDIR}/main.o
 
 # Source Files
-SOURCEFILES=apps/app_http.c apps/app_ssl_selftest.c drivers/mrf24wn/mrf.c drivers/mrf24wn/mrf_hal.c drivers/mrf24wn/mrf_lib.c drivers/mrf24wn/mrf_osal.c drivers/mrf24wn/mrf_isr.S middleware/freertos/portable/MemMang/heap_4.c middleware/freertos/portable/MPLAB/PIC32MZ/port.c middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.S middleware/freertos/croutine.c middleware/freertos/event_groups.c middleware/freertos/list.c middleware/freertos/queue.c middleware/freertos/stream_buffer.c middleware/freertos/tasks.c middleware/freertos/timers.c middleware/http/httpclient.c middleware/lwip/api/api_lib.c middleware/lwip/api/api_msg.c middleware/lwip/api/err.c middleware/lwip/api/netbuf.c middleware/lwip/api/netdb.c middleware/lwip/api/netifapi.c middleware/lwip/api/sockets.c middleware/lwip/api/tcpip.c middleware/lwip/core/ipv4/autoip.c middleware/lwip/core/ipv4/dhcp.c middleware/lwip/core/ipv4/etharp.c middleware/lwip/core/ipv4/icmp.c middleware/lwip/core/ipv4/igmp.c middleware/lwip/core/ipv4/ip4.c middleware/lwip/core/ipv4/ip4_addr.c middleware/lwip/core/ipv4/ip4_frag.c middleware/lwip/core/ipv6/dhcp6.c middleware/lwip/core/ipv6/ethip6.c middleware/lwip/core/ipv6/icmp6.c middleware/lwip/core/ipv6/inet6.c middleware/lwip/core/ipv6/ip6.c middleware/lwip/core/ipv6/ip6_addr.c middleware/lwip/core/ipv6/ip6_frag.c middleware/lwip/core/ipv6/mld6.c middleware/lwip/core/ipv6/nd6.c middleware/lwip/core/def.c middleware/lwip/core/dns.c middleware/lwip/core/inet_chksum.c middleware/lwip/core/init.c middleware/lwip/core/ip.c middleware/lwip/core/mem.c middleware/lwip/core/memp.c middleware/lwip/core/netif.c middleware/lwip/core/pbuf.c middleware/lwip/core/raw.c middleware/lwip/core/stats.c middleware/lwip/core/sys.c middleware/lwip/core/tcp.c middleware/lwip/core/tcp_in.c middleware/lwip/core/tcp_out.c middleware/lwip/core/timeouts.c middleware/lwip/core/udp.c middleware/lwip/netif/ppp/polarssl/arc4.c middleware/lwip/netif/ppp/polarssl/des.c middleware/lwip/netif/ppp/polarssl/md4.c middleware/lwip/netif/ppp/polarssl/md5.c middleware/lwip/netif/ppp/polarssl/sha1.c middleware/lwip/netif/ppp/auth.c middleware/lwip/netif/ppp/ccp.c middleware/lwip/netif/ppp/chap-md5.c middleware/lwip/netif/ppp/chap-new.c middleware/lwip/netif/ppp/chap_ms.c middleware/lwip/netif/ppp/demand.c middleware/lwip/netif/ppp/eap.c middleware/lwip/netif/ppp/ecp.c middleware/lwip/netif/ppp/eui64.c middleware/lwip/netif/ppp/fsm.c middleware/lwip/netif/ppp/ipcp.c middleware/lwip/netif/ppp/ipv6cp.c middleware/lwip/netif/ppp/lcp.c middleware/lwip/netif/ppp/magic.c middleware/lwip/netif/ppp/mppe.c middleware/lwip/netif/ppp/multilink.c middleware/lwip/netif/ppp/ppp.c middleware/lwip/netif/ppp/pppapi.c middleware/lwip/netif/ppp/pppcrypt.c middleware/lwip/netif/ppp/pppoe.c middleware/lwip/netif/ppp/pppol2tp.c middleware/lwip/netif/ppp/pppos.c middleware/lwip/netif/ppp/upap.c middleware/lwip/netif/ppp/utils.c middleware/lwip/netif/ppp/vj.c middleware/lwip/netif/ethernet.c middleware/lwip/netif/ethernetif.c middleware/lwip/port/sys_arch.c middleware/mbedtls/port/pic32_crypto.c middleware/mbedtls/port/alt_md5.c middleware/mbedtls/port/alt_sha1.c middleware/mbedtls/port/alt_aes.c middleware/mbedtls/port/alt_des.c middleware/mbedtls/port/alt_sha256.c middleware/mbedtls/aes.c middleware/mbedtls/aesni.c middleware/mbedtls/arc4.c middleware/mbedtls/asn1parse.c middleware/mbedtls/asn1write.c middleware/mbedtls/base64.c middleware/mbedtls/bignum.c middleware/mbedtls/blowfish.c middleware/mbedtls/camellia.c middleware/mbedtls/ccm.c middleware/mbedtls/certs.c middleware/mbedtls/cipher.c middleware/mbedtls/cipher_wrap.c middleware/mbedtls/cmac.c middleware/mbedtls/ctr_drbg.c middleware/mbedtls/debug.c middleware/mbedtls/des.c middleware/mbedtls/dhm.c middleware/mbedtls/ecdh.c middleware/mbedtls/ecdsa.c middleware/mbedtls/ecjpake.c middleware/mbedtls/ecp.c middleware/mbedtls/ecp_curves.c middleware/mbedtls/entropy.c middleware/mbedtls/entropy_poll.c middleware/mbedtls/error.c middleware/mbedtls/gcm.c middleware/mbedtls/havege.c middleware/mbedtls/hmac_drbg.c middleware/mbedtls/md.c middleware/mbedtls/md2.c middleware/mbedtls/md4.c middleware/mbedtls/md5.c middleware/mbedtls/md_wrap.c middleware/mbedtls/memory_buffer_alloc.c middleware/mbedtls/net_sockets.c middleware/mbedtls/oid.c middleware/mbedtls/padlock.c middleware/mbedtls/pem.c middleware/mbedtls/pk.c middleware/mbedtls/pkcs11.c middleware/mbedtls/pkcs12.c middleware/mbedtls/pkcs5.c middleware/mbedtls/pkparse.c middleware/mbedtls/pkwrite.c middleware/mbedtls/pk_wrap.c middleware/mbedtls/platform.c middleware/mbedtls/ripemd160.c middleware/mbedtls/rsa.c middleware/mbedtls/sha1.c middleware/mbedtls/sha256.c middleware/mbedtls/sha512.c middleware/mbedtls/ssl_cache.c middleware/mbedtls/ssl_ciphersuites.c middleware/mbedtls/ssl_cli.c middleware/mbedtls/ssl_cookie.c middleware/mbedtls/ssl_srv.c middleware/mbedtls/ssl_ticket.c middleware/mbedtls/ssl_tls.c middleware/mbedtls/threading.c middleware/mbedtls/timing.c middleware/mbedtls/version.c middleware/mbedtls/version_features.c middleware/mbedtls/x509.c middleware/mbedtls/x509write_crt.c middleware/mbedtls/x509write_csr.c middleware/mbedtls/x509_create.c middleware/mbedtls/x509_crl.c middleware/mbedtls/x509_crt.c middleware/mbedtls/x509_csr.c middleware/mbedtls/xtea.c middleware/wizio/freertos_common.c middleware/wizio/wrap_mem.c middleware/wizio/osal.c sys/sys.c sys/sys_common.c sys/sys_config.c sys/sys_rtcc.c sys/sys_trap.c sys/sys_log.c main.c
+SOURCEFILES=apps/app_http.c apps/app_bench.c apps/app_ssl_selftest.c drivers/mrf24wn/mrf.c drivers/mrf24wn/mrf_hal.c drivers/mrf24wn/mrf_lib.c drivers/mrf24wn/mrf_filter.c drivers/mrf24wn/mrf_osal.c drivers/mrf24wn/mrf_isr.S sys/sys_log_isr.S sys/sys_hrtimer_isr.S middleware/freertos/portable/MemMang/heap_4.c middleware/freertos/portable/MemMang/umm_malloc.c middleware/freertos/portable/MemMang/heap_umm.c middleware/freertos/portable/MPLAB/PIC32MZ/port.c middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.S middleware/freertos/croutine.c middleware/freertos/event_groups.c middleware/freertos/list.c middleware/freertos/queue.c middleware/freertos/stream_buffer.c middleware/freertos/tasks.c middleware/freertos/timers.c middleware/http/httpclient.c middleware/lwip/api/api_lib.c middleware/lwip/api/api_msg.c middleware/lwip/api/err.c middleware/lwip/api/netbuf.c middleware/lwip/api/netdb.c middleware/lwip/api/netifapi.c middleware/lwip/api/sockets.c middleware/lwip/api/tcpip.c middleware/lwip/core/ipv4/autoip.c middleware/lwip/core/ipv4/dhcp.c middleware/lwip/core/ipv4/etharp.c middleware/lwip/core/ipv4/icmp.c middleware/lwip/core/ipv4/igmp.c middleware/lwip/core/ipv4/ip4.c middleware/lwip/core/ipv4/ip4_addr.c middleware/lwip/core/ipv4/ip4_frag.c middleware/lwip/core/ipv6/dhcp6.c middleware/lwip/core/ipv6/ethip6.c middleware/lwip/core/ipv6/icmp6.c middleware/lwip/core/ipv6/inet6.c middleware/lwip/core/ipv6/ip6.c middleware/lwip/core/ipv6/ip6_addr.c middleware/lwip/core/ipv6/ip6_frag.c middleware/lwip/core/ipv6/mld6.c middleware/lwip/core/ipv6/nd6.c middleware/lwip/core/def.c middleware/lwip/core/dns.c middleware/lwip/core/inet_chksum.c middleware/lwip/core/init.c middleware/lwip/core/ip.c middleware/lwip/core/mem.c middleware/lwip/core/memp.c middleware/lwip/core/netif.c middleware/lwip/core/pbuf.c middleware/lwip/core/raw.c middleware/lwip/core/stats.c middleware/lwip/core/sys.c middleware/lwip/core/tcp.c middleware/lwip/core/tcp_in.c middleware/lwip/core/tcp_out.c middleware/lwip/core/timeouts.c middleware/lwip/core/udp.c middleware/lwip/netif/ppp/polarssl/arc4.c middleware/lwip/netif/ppp/polarssl/des.c middleware/lwip/netif/ppp/polarssl/md4.c middleware/lwip/netif/ppp/polarssl/md5.c middleware/lwip/netif/ppp/polarssl/sha1.c middleware/lwip/netif/ppp/auth.c middleware/lwip/netif/ppp/ccp.c middleware/lwip/netif/ppp/chap-md5.c middleware/lwip/netif/ppp/chap-new.c middleware/lwip/netif/ppp/chap_ms.c middleware/lwip/netif/ppp/demand.c middleware/lwip/netif/ppp/eap.c middleware/lwip/netif/ppp/ecp.c middleware/lwip/netif/ppp/eui64.c middleware/lwip/netif/ppp/fsm.c middleware/lwip/netif/ppp/ipcp.c middleware/lwip/netif/ppp/ipv6cp.c middleware/lwip/netif/ppp/lcp.c middleware/lwip/netif/ppp/magic.c middleware/lwip/netif/ppp/mppe.c middleware/lwip/netif/ppp/multilink.c middleware/lwip/netif/ppp/ppp.c middleware/lwip/netif/ppp/pppapi.c middleware/lwip/netif/ppp/pppcrypt.c middleware/lwip/netif/ppp/pppoe.c middleware/lwip/netif/ppp/pppol2tp.c middleware/lwip/netif/ppp/pppos.c middleware/lwip/netif/ppp/upap.c middleware/lwip/netif/ppp/utils.c middleware/lwip/netif/ppp/vj.c middleware/lwip/netif/ethernet.c middleware/lwip/netif/ethernetif.c middleware/lwip/port/sys_arch.c middleware/mbedtls/port/pic32_crypto.c middleware/mbedtls/port/tls_arena.c middleware/mbedtls/port/alt_md5.c middleware/mbedtls/port/alt_sha1.c middleware/mbedtls/port/alt_aes.c middleware/mbedtls/port/alt_des.c middleware/mbedtls/port/alt_sha256.c middleware/mbedtls/aes.c middleware/mbedtls/aesni.c middleware/mbedtls/arc4.c middleware/mbedtls/asn1parse.c middleware/mbedtls/asn1write.c middleware/mbedtls/base64.c middleware/mbedtls/bignum.c middleware/mbedtls/blowfish.c middleware/mbedtls/camellia.c middleware/mbedtls/ccm.c middleware/mbedtls/certs.c middleware/mbedtls/cipher.c middleware/mbedtls/cipher_wrap.c middleware/mbedtls/cmac.c middleware/mbedtls/ctr_drbg.c middleware/mbedtls/debug.c middleware/mbedtls/des.c middleware/mbedtls/dhm.c middleware/mbedtls/ecdh.c middleware/mbedtls/ecdsa.c middleware/mbedtls/ecjpake.c middleware/mbedtls/ecp.c middleware/mbedtls/ecp_curves.c middleware/mbedtls/entropy.c middleware/mbedtls/entropy_poll.c middleware/mbedtls/error.c middleware/mbedtls/gcm.c middleware/mbedtls/havege.c middleware/mbedtls/hmac_drbg.c middleware/mbedtls/md.c middleware/mbedtls/md2.c middleware/mbedtls/md4.c middleware/mbedtls/md5.c middleware/mbedtls/md_wrap.c middleware/mbedtls/memory_buffer_alloc.c middleware/mbedtls/net_sockets.c middleware/mbedtls/oid.c middleware/mbedtls/padlock.c middleware/mbedtls/pem.c middleware/mbedtls/pk.c middleware/mbedtls/pkcs11.c middleware/mbedtls/pkcs12.c middleware/mbedtls/pkcs5.c middleware/mbedtls/pkparse.c middleware/mbedtls/pkwrite.c middleware/mbedtls/pk_wrap.c middleware/mbedtls/platform.c middleware/mbedtls/ripemd160.c middleware/mbedtls/rsa.c middleware/mbedtls/sha1.c middleware/mbedtls/sha256.c middleware/mbedtls/sha512.c middleware/mbedtls/ssl_cache.c middleware/mbedtls/ssl_ciphersuites.c middleware/mbedtls/ssl_cli.c middleware/mbedtls/ssl_cookie.c middleware/mbedtls/ssl_srv.c middleware/mbedtls/ssl_ticket.c middleware/mbedtls/ssl_tls.c middleware/mbedtls/threading.c middleware/mbedtls/timing.c middleware/mbedtls/version.c middleware/mbedtls/version_features.c middleware/mbedtls/x509.c middleware/mbedtls/x509write_crt.c middleware/mbedtls/x509write_csr.c middleware/mbedtls/x509_create.c middleware/mbedtls/x509_crl.c middleware/mbedtls/x509_crt.c middleware/mbedtls/x509_csr.c middleware/mbedtls/xtea.c middleware/wizio/freertos_common.c middleware/wizio/wrap_mem.c middleware/wizio/slab.c middleware/wizio/rtos_static.c middleware/wizio/mpsc.c middleware/wizio/nsem.c middleware/wizio/coro.c middleware/wizio/twheel.c middleware/wizio/cpu_stats.c middleware/wizio/stack_mon.c middleware/wizio/trace_rec.c middleware/wizio/heap_trace.c middleware/wizio/osal.c sys/sys.c sys/sys_common.c sys/sys_config.c sys/sys_rtcc.c sys/sys_trap.c sys/sys_log.c sys/sys_hrtimer.c main.c
 
 
 CFLAGS=
@@ -107,6 +107,20 @@ ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o: drivers/mrf24wn/mrf_isr.S  nbproject/Mak
 	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.ok ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.err 
 	@${FIXDEPS} "${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.d" "${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.asm.d" -t $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC} $(MP_EXTRA_AS_PRE)  -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -c -mprocessor=$(MP_PROCESSOR_OPTION) -I"middleware/freertos/include" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -MMD -MF "${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.d"  -o ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o drivers/mrf24wn/mrf_isr.S  -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  -Wa,--defsym=__MPLAB_BUILD=1$(MP_EXTRA_AS_POST),-MD="${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.asm.d",--defsym=__ICD2RAM=1,--defsym=__MPLAB_DEBUG=1,--gdwarf-2,--defsym=__DEBUG=1,--defsym=__MPLAB_DEBUGGER_PK3=1
 	
+${OBJECTDIR}/sys/sys_log_isr.o: sys/sys_log_isr.S  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/sys" 
+	@${RM} ${OBJECTDIR}/sys/sys_log_isr.o.d 
+	@${RM} ${OBJECTDIR}/sys/sys_log_isr.o 
+	@${RM} ${OBJECTDIR}/sys/sys_log_isr.o.ok ${OBJECTDIR}/sys/sys_log_isr.o.err 
+	@${FIXDEPS} "${OBJECTDIR}/sys/sys_log_isr.o.d" "${OBJECTDIR}/sys/sys_log_isr.o.asm.d" -t $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC} $(MP_EXTRA_AS_PRE)  -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -c -mprocessor=$(MP_PROCESSOR_OPTION) -I"sys" -I"middleware/freertos/include" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -MMD -MF "${OBJECTDIR}/sys/sys_log_isr.o.d"  -o ${OBJECTDIR}/sys/sys_log_isr.o sys/sys_log_isr.S  -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  -Wa,--defsym=__MPLAB_BUILD=1$(MP_EXTRA_AS_POST),-MD="${OBJECTDIR}/sys/sys_log_isr.o.asm.d",--defsym=__ICD2RAM=1,--defsym=__MPLAB_DEBUG=1,--gdwarf-2,--defsym=__DEBUG=1,--defsym=__MPLAB_DEBUGGER_PK3=1
+	
+${OBJECTDIR}/sys/sys_hrtimer_isr.o: sys/sys_hrtimer_isr.S  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/sys" 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer_isr.o.d 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer_isr.o 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer_isr.o.ok ${OBJECTDIR}/sys/sys_hrtimer_isr.o.err 
+	@${FIXDEPS} "${OBJECTDIR}/sys/sys_hrtimer_isr.o.d" "${OBJECTDIR}/sys/sys_hrtimer_isr.o.asm.d" -t $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC} $(MP_EXTRA_AS_PRE)  -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -c -mprocessor=$(MP_PROCESSOR_OPTION) -I"sys" -I"middleware/freertos/include" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -MMD -MF "${OBJECTDIR}/sys/sys_hrtimer_isr.o.d"  -o ${OBJECTDIR}/sys/sys_hrtimer_isr.o sys/sys_hrtimer_isr.S  -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  -Wa,--defsym=__MPLAB_BUILD=1$(MP_EXTRA_AS_POST),-MD="${OBJECTDIR}/sys/sys_hrtimer_isr.o.asm.d",--defsym=__ICD2RAM=1,--defsym=__MPLAB_DEBUG=1,--gdwarf-2,--defsym=__DEBUG=1,--defsym=__MPLAB_DEBUGGER_PK3=1
+	
 ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o: middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.S  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ" 
 	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o.d 
@@ -122,6 +136,20 @@ ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o: drivers/mrf24wn/mrf_isr.S  nbproject/Mak
 	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.ok ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.err 
 	@${FIXDEPS} "${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.d" "${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.asm.d" -t $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC} $(MP_EXTRA_AS_PRE)  -c -mprocessor=$(MP_PROCESSOR_OPTION) -I"middleware/freertos/include" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -MMD -MF "${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.d"  -o ${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o drivers/mrf24wn/mrf_isr.S  -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  -Wa,--defsym=__MPLAB_BUILD=1$(MP_EXTRA_AS_POST),-MD="${OBJECTDIR}/drivers/mrf24wn/mrf_isr.o.asm.d",--gdwarf-2
 	
+${OBJECTDIR}/sys/sys_log_isr.o: sys/sys_log_isr.S  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/sys" 
+	@${RM} ${OBJECTDIR}/sys/sys_log_isr.o.d 
+	@${RM} ${OBJECTDIR}/sys/sys_log_isr.o 
+	@${RM} ${OBJECTDIR}/sys/sys_log_isr.o.ok ${OBJECTDIR}/sys/sys_log_isr.o.err 
+	@${FIXDEPS} "${OBJECTDIR}/sys/sys_log_isr.o.d" "${OBJECTDIR}/sys/sys_log_isr.o.asm.d" -t $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC} $(MP_EXTRA_AS_PRE)  -c -mprocessor=$(MP_PROCESSOR_OPTION) -I"sys" -I"middleware/freertos/include" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -MMD -MF "${OBJECTDIR}/sys/sys_log_isr.o.d"  -o ${OBJECTDIR}/sys/sys_log_isr.o sys/sys_log_isr.S  -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  -Wa,--defsym=__MPLAB_BUILD=1$(MP_EXTRA_AS_POST),-MD="${OBJECTDIR}/sys/sys_log_isr.o.asm.d",--gdwarf-2
+	
+${OBJECTDIR}/sys/sys_hrtimer_isr.o: sys/sys_hrtimer_isr.S  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/sys" 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer_isr.o.d 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer_isr.o 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer_isr.o.ok ${OBJECTDIR}/sys/sys_hrtimer_isr.o.err 
+	@${FIXDEPS} "${OBJECTDIR}/sys/sys_hrtimer_isr.o.d" "${OBJECTDIR}/sys/sys_hrtimer_isr.o.asm.d" -t $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC} $(MP_EXTRA_AS_PRE)  -c -mprocessor=$(MP_PROCESSOR_OPTION) -I"sys" -I"middleware/freertos/include" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -MMD -MF "${OBJECTDIR}/sys/sys_hrtimer_isr.o.d"  -o ${OBJECTDIR}/sys/sys_hrtimer_isr.o sys/sys_hrtimer_isr.S  -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  -Wa,--defsym=__MPLAB_BUILD=1$(MP_EXTRA_AS_POST),-MD="${OBJECTDIR}/sys/sys_hrtimer_isr.o.asm.d",--gdwarf-2
+	
 ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o: middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.S  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ" 
 	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port_asm.o.d 
@@ -140,6 +168,12 @@ ${OBJECTDIR}/apps/app_http.o: apps/app_http.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/apps/app_http.o 
 	@${FIXDEPS} "${OBJECTDIR}/apps/app_http.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/apps/app_http.o.d" -o ${OBJECTDIR}/apps/app_http.o apps/app_http.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/apps/app_bench.o: apps/app_bench.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/apps" 
+	@${RM} ${OBJECTDIR}/apps/app_bench.o.d 
+	@${RM} ${OBJECTDIR}/apps/app_bench.o 
+	@${FIXDEPS} "${OBJECTDIR}/apps/app_bench.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/apps/app_bench.o.d" -o ${OBJECTDIR}/apps/app_bench.o apps/app_bench.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/apps/app_ssl_selftest.o: apps/app_ssl_selftest.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/apps" 
 	@${RM} ${OBJECTDIR}/apps/app_ssl_selftest.o.d 
@@ -164,6 +198,12 @@ ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o: drivers/mrf24wn/mrf_lib.c  nbproject/Mak
 	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o 
 	@${FIXDEPS} "${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o.d" -o ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o drivers/mrf24wn/mrf_lib.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o: drivers/mrf24wn/mrf_filter.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/drivers/mrf24wn" 
+	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o.d 
+	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o 
+	@${FIXDEPS} "${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o.d" -o ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o drivers/mrf24wn/mrf_filter.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o: drivers/mrf24wn/mrf_osal.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/drivers/mrf24wn" 
 	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o.d 
@@ -176,6 +216,18 @@ ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o: middleware/freertos/
 	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o 
 	@${FIXDEPS} "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o.d" -o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o middleware/freertos/portable/MemMang/heap_4.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o: middleware/freertos/portable/MemMang/umm_malloc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MemMang" 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o.d 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o.d" -o ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o middleware/freertos/portable/MemMang/umm_malloc.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o: middleware/freertos/portable/MemMang/heap_umm.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MemMang" 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o.d 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o.d" -o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o middleware/freertos/portable/MemMang/heap_umm.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o: middleware/freertos/portable/MPLAB/PIC32MZ/port.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ" 
 	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o.d 
@@ -686,6 +738,12 @@ ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o: middleware/mbedtls/port/pic
 	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o 
 	@${FIXDEPS} "${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o.d" -o ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o middleware/mbedtls/port/pic32_crypto.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o: middleware/mbedtls/port/tls_arena.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/mbedtls/port" 
+	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o.d 
+	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o.d" -o ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o middleware/mbedtls/port/tls_arena.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o: middleware/mbedtls/port/alt_md5.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/mbedtls/port" 
 	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o.d 
@@ -1154,6 +1212,66 @@ ${OBJECTDIR}/middleware/wizio/wrap_mem.o: middleware/wizio/wrap_mem.c  nbproject
 	@${RM} ${OBJECTDIR}/middleware/wizio/wrap_mem.o 
 	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/wrap_mem.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/wrap_mem.o.d" -o ${OBJECTDIR}/middleware/wizio/wrap_mem.o middleware/wizio/wrap_mem.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/middleware/wizio/slab.o: middleware/wizio/slab.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/slab.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/slab.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/slab.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/slab.o.d" -o ${OBJECTDIR}/middleware/wizio/slab.o middleware/wizio/slab.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/rtos_static.o: middleware/wizio/rtos_static.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/rtos_static.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/rtos_static.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/rtos_static.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/rtos_static.o.d" -o ${OBJECTDIR}/middleware/wizio/rtos_static.o middleware/wizio/rtos_static.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/mpsc.o: middleware/wizio/mpsc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/mpsc.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/mpsc.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/mpsc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/mpsc.o.d" -o ${OBJECTDIR}/middleware/wizio/mpsc.o middleware/wizio/mpsc.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/nsem.o: middleware/wizio/nsem.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/nsem.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/nsem.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/nsem.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/nsem.o.d" -o ${OBJECTDIR}/middleware/wizio/nsem.o middleware/wizio/nsem.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/coro.o: middleware/wizio/coro.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/coro.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/coro.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/coro.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/coro.o.d" -o ${OBJECTDIR}/middleware/wizio/coro.o middleware/wizio/coro.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/twheel.o: middleware/wizio/twheel.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/twheel.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/twheel.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/twheel.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/twheel.o.d" -o ${OBJECTDIR}/middleware/wizio/twheel.o middleware/wizio/twheel.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/cpu_stats.o: middleware/wizio/cpu_stats.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/cpu_stats.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/cpu_stats.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/cpu_stats.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/cpu_stats.o.d" -o ${OBJECTDIR}/middleware/wizio/cpu_stats.o middleware/wizio/cpu_stats.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/stack_mon.o: middleware/wizio/stack_mon.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/stack_mon.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/stack_mon.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/stack_mon.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/stack_mon.o.d" -o ${OBJECTDIR}/middleware/wizio/stack_mon.o middleware/wizio/stack_mon.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/trace_rec.o: middleware/wizio/trace_rec.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/trace_rec.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/trace_rec.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/trace_rec.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/trace_rec.o.d" -o ${OBJECTDIR}/middleware/wizio/trace_rec.o middleware/wizio/trace_rec.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/heap_trace.o: middleware/wizio/heap_trace.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/heap_trace.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/heap_trace.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/heap_trace.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/heap_trace.o.d" -o ${OBJECTDIR}/middleware/wizio/heap_trace.o middleware/wizio/heap_trace.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/middleware/wizio/osal.o: middleware/wizio/osal.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
 	@${RM} ${OBJECTDIR}/middleware/wizio/osal.o.d 
@@ -1196,6 +1314,12 @@ ${OBJECTDIR}/sys/sys_log.o: sys/sys_log.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/sys/sys_log.o 
 	@${FIXDEPS} "${OBJECTDIR}/sys/sys_log.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/sys/sys_log.o.d" -o ${OBJECTDIR}/sys/sys_log.o sys/sys_log.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/sys/sys_hrtimer.o: sys/sys_hrtimer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/sys" 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer.o.d 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer.o 
+	@${FIXDEPS} "${OBJECTDIR}/sys/sys_hrtimer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/sys/sys_hrtimer.o.d" -o ${OBJECTDIR}/sys/sys_hrtimer.o sys/sys_hrtimer.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.o.d 
@@ -1209,6 +1333,12 @@ ${OBJECTDIR}/apps/app_http.o: apps/app_http.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/apps/app_http.o 
 	@${FIXDEPS} "${OBJECTDIR}/apps/app_http.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/apps/app_http.o.d" -o ${OBJECTDIR}/apps/app_http.o apps/app_http.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/apps/app_bench.o: apps/app_bench.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/apps" 
+	@${RM} ${OBJECTDIR}/apps/app_bench.o.d 
+	@${RM} ${OBJECTDIR}/apps/app_bench.o 
+	@${FIXDEPS} "${OBJECTDIR}/apps/app_bench.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/apps/app_bench.o.d" -o ${OBJECTDIR}/apps/app_bench.o apps/app_bench.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/apps/app_ssl_selftest.o: apps/app_ssl_selftest.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/apps" 
 	@${RM} ${OBJECTDIR}/apps/app_ssl_selftest.o.d 
@@ -1233,6 +1363,12 @@ ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o: drivers/mrf24wn/mrf_lib.c  nbproject/Mak
 	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o 
 	@${FIXDEPS} "${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o.d" -o ${OBJECTDIR}/drivers/mrf24wn/mrf_lib.o drivers/mrf24wn/mrf_lib.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o: drivers/mrf24wn/mrf_filter.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/drivers/mrf24wn" 
+	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o.d 
+	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o 
+	@${FIXDEPS} "${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o.d" -o ${OBJECTDIR}/drivers/mrf24wn/mrf_filter.o drivers/mrf24wn/mrf_filter.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o: drivers/mrf24wn/mrf_osal.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/drivers/mrf24wn" 
 	@${RM} ${OBJECTDIR}/drivers/mrf24wn/mrf_osal.o.d 
@@ -1245,6 +1381,18 @@ ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o: middleware/freertos/
 	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o 
 	@${FIXDEPS} "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o.d" -o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_4.o middleware/freertos/portable/MemMang/heap_4.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o: middleware/freertos/portable/MemMang/umm_malloc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MemMang" 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o.d 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o.d" -o ${OBJECTDIR}/middleware/freertos/portable/MemMang/umm_malloc.o middleware/freertos/portable/MemMang/umm_malloc.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o: middleware/freertos/portable/MemMang/heap_umm.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MemMang" 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o.d 
+	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o.d" -o ${OBJECTDIR}/middleware/freertos/portable/MemMang/heap_umm.o middleware/freertos/portable/MemMang/heap_umm.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o: middleware/freertos/portable/MPLAB/PIC32MZ/port.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ" 
 	@${RM} ${OBJECTDIR}/middleware/freertos/portable/MPLAB/PIC32MZ/port.o.d 
@@ -1755,6 +1903,12 @@ ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o: middleware/mbedtls/port/pic
 	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o 
 	@${FIXDEPS} "${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o.d" -o ${OBJECTDIR}/middleware/mbedtls/port/pic32_crypto.o middleware/mbedtls/port/pic32_crypto.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o: middleware/mbedtls/port/tls_arena.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/mbedtls/port" 
+	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o.d 
+	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o.d" -o ${OBJECTDIR}/middleware/mbedtls/port/tls_arena.o middleware/mbedtls/port/tls_arena.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o: middleware/mbedtls/port/alt_md5.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/mbedtls/port" 
 	@${RM} ${OBJECTDIR}/middleware/mbedtls/port/alt_md5.o.d 
@@ -2223,6 +2377,66 @@ ${OBJECTDIR}/middleware/wizio/wrap_mem.o: middleware/wizio/wrap_mem.c  nbproject
 	@${RM} ${OBJECTDIR}/middleware/wizio/wrap_mem.o 
 	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/wrap_mem.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/wrap_mem.o.d" -o ${OBJECTDIR}/middleware/wizio/wrap_mem.o middleware/wizio/wrap_mem.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/middleware/wizio/slab.o: middleware/wizio/slab.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/slab.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/slab.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/slab.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/slab.o.d" -o ${OBJECTDIR}/middleware/wizio/slab.o middleware/wizio/slab.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/rtos_static.o: middleware/wizio/rtos_static.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/rtos_static.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/rtos_static.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/rtos_static.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/rtos_static.o.d" -o ${OBJECTDIR}/middleware/wizio/rtos_static.o middleware/wizio/rtos_static.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/mpsc.o: middleware/wizio/mpsc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/mpsc.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/mpsc.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/mpsc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/mpsc.o.d" -o ${OBJECTDIR}/middleware/wizio/mpsc.o middleware/wizio/mpsc.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/nsem.o: middleware/wizio/nsem.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/nsem.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/nsem.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/nsem.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/nsem.o.d" -o ${OBJECTDIR}/middleware/wizio/nsem.o middleware/wizio/nsem.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/coro.o: middleware/wizio/coro.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/coro.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/coro.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/coro.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/coro.o.d" -o ${OBJECTDIR}/middleware/wizio/coro.o middleware/wizio/coro.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/twheel.o: middleware/wizio/twheel.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/twheel.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/twheel.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/twheel.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/twheel.o.d" -o ${OBJECTDIR}/middleware/wizio/twheel.o middleware/wizio/twheel.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/cpu_stats.o: middleware/wizio/cpu_stats.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/cpu_stats.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/cpu_stats.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/cpu_stats.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/cpu_stats.o.d" -o ${OBJECTDIR}/middleware/wizio/cpu_stats.o middleware/wizio/cpu_stats.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/stack_mon.o: middleware/wizio/stack_mon.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/stack_mon.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/stack_mon.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/stack_mon.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/stack_mon.o.d" -o ${OBJECTDIR}/middleware/wizio/stack_mon.o middleware/wizio/stack_mon.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/trace_rec.o: middleware/wizio/trace_rec.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/trace_rec.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/trace_rec.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/trace_rec.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/trace_rec.o.d" -o ${OBJECTDIR}/middleware/wizio/trace_rec.o middleware/wizio/trace_rec.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/middleware/wizio/heap_trace.o: middleware/wizio/heap_trace.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
+	@${RM} ${OBJECTDIR}/middleware/wizio/heap_trace.o.d 
+	@${RM} ${OBJECTDIR}/middleware/wizio/heap_trace.o 
+	@${FIXDEPS} "${OBJECTDIR}/middleware/wizio/heap_trace.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/middleware/wizio/heap_trace.o.d" -o ${OBJECTDIR}/middleware/wizio/heap_trace.o middleware/wizio/heap_trace.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/middleware/wizio/osal.o: middleware/wizio/osal.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/middleware/wizio" 
 	@${RM} ${OBJECTDIR}/middleware/wizio/osal.o.d 
@@ -2265,6 +2479,12 @@ ${OBJECTDIR}/sys/sys_log.o: sys/sys_log.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/sys/sys_log.o 
 	@${FIXDEPS} "${OBJECTDIR}/sys/sys_log.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/sys/sys_log.o.d" -o ${OBJECTDIR}/sys/sys_log.o sys/sys_log.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/sys/sys_hrtimer.o: sys/sys_hrtimer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/sys" 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer.o.d 
+	@${RM} ${OBJECTDIR}/sys/sys_hrtimer.o 
+	@${FIXDEPS} "${OBJECTDIR}/sys/sys_hrtimer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"sys" -I"sys/fan" -I"middleware/freertos/include" -I"middleware/freertos/portable/MemMang" -I"middleware/freertos/portable/MPLAB/PIC32MZ" -I"middleware/wizio" -I"middleware/lwip/include" -I"middleware/lwip/port/include" -I"drivers/mrf24wn" -I"middleware" -I"middleware/mbedtls/configs" -I"middleware/mbedtls/include" -I"middleware/mbedtls/port" -I"middleware/http" -I"apps" -MMD -MF "${OBJECTDIR}/sys/sys_hrtimer.o.d" -o ${OBJECTDIR}/sys/sys_hrtimer.o sys/sys_hrtimer.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.o.d 
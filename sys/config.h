@@ -16,8 +16,17 @@
 
 #define DEBUG                       /* GLOBAL ENABLE */
 #define DBG_SPEED                   230400
-//#define DBG_USE_DMA    
+#define DBG_USE_RING                /* Printf formats to RAM, LOG task drains to UART */
+#define DBG_RING_SIZE               4096 /* power of 2 */
+#define DBG_LINE_MAX                128 /* Printf stack buffer, longer lines are formatted twice */
+#define DBG_DRAIN_MS                10
+//#define DBG_USE_BIN                 /* LOG() and LOGI() as binary records decoded by tools/log_decode.py, text otherwise */
+//#define DBG_USE_DMA                 /* LOG task drains with DMA0, needs DBG_USE_RING */
 #define DBG_BUF_MAX                 512 /* for DMA debug buffer is coherent */
+#define DBG_DMA_PRIO                1
+
+// WIFI SPI3 mrf_hal.c /////////////////////////////////////////////////////////
+#define WF_USE_DMA                  /* MRF24WN frames move with DMA1 ( RX ) and DMA2 ( TX ) */
 
 // WIFI SSID mrf.h /////////////////////////////////////////////////////////////
 #define WDRV_DEFAULT_SSID           "Comet Guest Room"    
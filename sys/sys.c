@@ -5,6 +5,7 @@
 
 #include "sys.h"
 #include "fan_system.h"
+#include "sys_hrtimer.h"
 
 /* Used from MRF24 LIB */
 bool SYS_INT_Disable(void) {
@@ -25,7 +26,7 @@ void SYS_CMD_MESSAGE(const char * message) {
 void SYS_CMD_PRINT(const char * f, ...) {
     va_list a;
     va_start(a, f);
-    vprintf(f, a);
+    vPrintf(f, a);
     va_end(a);
 }
 
@@ -52,28 +53,18 @@ void __attribute__((noreturn)) SYS_SoftReset(void) {
 }
 
 uint32_t ElapsedTime(uint32_t startTime, uint32_t currentTime) {
-    /* ROLLOVER SAFE */
-    if (currentTime >= startTime) {
-        return ( currentTime - startTime);
-    } else {
-        return ( ((uint32_t) 0xffffffff) - currentTime) +startTime;
-    }
+    return currentTime - startTime; /* ROLLOVER SAFE for raw core timer values */
 }
 
+/* busy wait, TickMS() and TickUS() wrap with the core timer, not at 2^32, so count raw ticks */
 void DelayMS(uint32_t t) {
-    uint32_t startTime = TickMS();
-    do {
-        if (ElapsedTime(startTime, TickMS()) > t)
-            return;
-    } while (1);
+    while (t--)
+        DelayUS(1000);
 }
 
 void DelayUS(uint32_t t) {
-    uint32_t startTime = TickUS();
-    do {
-        if (ElapsedTime(startTime, TickMS()) > t)
-            return;
-    } while (1);
+    uint32_t startTime = ReadCoreTimer();
+    while (ElapsedTime(startTime, ReadCoreTimer()) < t * us_SCALE);
 }
 
 uint32_t sys_rand(void) {
@@ -93,6 +84,7 @@ int SYS_Init(void) {
     CLEAR_GPIO();
     INIT_LED();               
     HardwareUseMultiVectoredInterrupts();
+    hrtimer_init();
 #ifdef DEBUG
     sys_log_init(DBG_SPEED);
     LOG("\n[DEBUG] INIT\n");
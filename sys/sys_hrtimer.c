@@ -0,0 +1,152 @@
+/*
+ *  High resolution timer, see sys_hrtimer.h
+ *  Armed timers are a list sorted by expire, Compare holds the head or the next wrap check
+ *  The list and the 64 bit extension are changed with the kernel interrupts masked,
+ *  so starting a timer from a task or from an ISR <= configMAX_SYSCALL_INTERRUPT_PRIORITY is fine
+ */
+
+#include "sys.h"
+#include "sys_hrtimer.h"
+#include "task.h"
+#include "nsem.h"
+#include "osal.h"
+
+#if defined(configTICK_INTERRUPT_VECTOR) && (configTICK_INTERRUPT_VECTOR == _CORE_TIMER_VECTOR)
+#error "the RTOS tick is on the core timer, sys_hrtimer needs it"
+#endif
+
+#define HRTIMER_KEEPALIVE   (1ull << 31)    /* ticks, half a wrap */
+#define HRTIMER_MARGIN      16              /* ticks, Compare closer than this may be passed already */
+
+static hrtimer_t * hr_list;
+static uint32_t hr_last, hr_high;
+
+/* kernel interrupts masked */
+static uint64_t hrtimer_now(void) {
+    uint32_t c = ReadCoreTimer();
+    if (c < hr_last)
+        hr_high++;
+    hr_last = c;
+    return ((uint64_t) hr_high << 32) | c;
+}
+
+/* kernel interrupts masked, true when the new Compare may be missed */
+static bool hrtimer_arm(uint64_t now) {
+    uint64_t next = now + HRTIMER_KEEPALIVE;
+    if (hr_list && hr_list->expire < next)
+        next = hr_list->expire;
+    _CP0_SET_COMPARE((uint32_t) next); // clears the pending match too
+    return (int32_t) ((uint32_t) next - ReadCoreTimer()) < HRTIMER_MARGIN;
+}
+
+static void hrtimer_unlink(hrtimer_t * t) {
+    hrtimer_t ** pt = &hr_list;
+    while (*pt && *pt != t)
+        pt = &(*pt)->next;
+    if (*pt)
+        *pt = t->next;
+    t->armed = false;
+}
+
+void hrtimer_init(void) {
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    hr_list = NULL;
+    hr_high = 0;
+    hr_last = ReadCoreTimer();
+    IEC0CLR = _IEC0_CTIE_MASK;
+    IPC0bits.CTIP = HRTIMER_INT_PRIO;
+    IPC0bits.CTIS = 0;
+    hrtimer_arm(hrtimer_now());
+    IFS0CLR = _IFS0_CTIF_MASK;
+    IEC0SET = _IEC0_CTIE_MASK;
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+uint64_t hrtimer_ticks(void) {
+    uint64_t now;
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    now = hrtimer_now();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    return now;
+}
+
+uint64_t hrtimer_us(void) {
+    return hrtimer_ticks() / us_SCALE;
+}
+
+void hrtimer_start(hrtimer_t * t, uint32_t us, hrtimer_cb_t cb, void * arg) {
+    hrtimer_t ** pt = &hr_list;
+    bool late = false;
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    if (t->armed)
+        hrtimer_unlink(t);
+    t->cb = cb;
+    t->arg = arg;
+    t->expire = hrtimer_now() + (uint64_t) us * us_SCALE;
+    while (*pt && (*pt)->expire <= t->expire)
+        pt = &(*pt)->next;
+    t->next = *pt;
+    *pt = t;
+    t->armed = true;
+    if (hr_list == t)
+        late = hrtimer_arm(hrtimer_now());
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    if (late)
+        IFS0SET = _IFS0_CTIF_MASK; // run it from the ISR now
+}
+
+bool hrtimer_cancel(hrtimer_t * t) {
+    bool armed;
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    if ((armed = t->armed))
+        hrtimer_unlink(t); // Compare stays, an early interrupt only re-arms
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    return armed;
+}
+
+/* core timer compare, sys_hrtimer_isr.S */
+void ISR_HRTIMER(void) {
+    BaseType_t woken = pdFALSE;
+    hrtimer_t * t;
+    uint64_t now;
+    UBaseType_t mask;
+    traceISR_ENTER(_CORE_TIMER_VECTOR);
+    mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    do {
+        IFS0CLR = _IFS0_CTIF_MASK;
+        now = hrtimer_now();
+        while ((t = hr_list) && t->expire <= now) {
+            hr_list = t->next;
+            t->armed = false;
+            portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+            t->cb(t, t->arg, &woken); // may start it again
+            mask = portSET_INTERRUPT_MASK_FROM_ISR();
+            now = hrtimer_now();
+        }
+    } while (hrtimer_arm(now));
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    traceISR_EXIT(_CORE_TIMER_VECTOR);
+    portEND_SWITCHING_ISR(woken);
+}
+
+void hrtimer_spin_us(uint32_t us) {
+    uint64_t end = hrtimer_ticks() + (uint64_t) us * us_SCALE;
+    while (hrtimer_ticks() < end);
+}
+
+static void hrtimer_wake(hrtimer_t * t, void * arg, BaseType_t * woken) {
+    nsem_give_from_isr((nsem_t *) arg, woken);
+}
+
+void hrtimer_delay_us(uint32_t us) {
+    hrtimer_t t = {0};
+    nsem_t done;
+    if (us < HRTIMER_SPIN_US || !osal_can_block()) {
+        hrtimer_spin_us(us);
+        return;
+    }
+    nsem_init(&done, 1, 0);
+    hrtimer_start(&t, us, hrtimer_wake, &done);
+    if (!nsem_take(&done, us / 1000 / portTICK_PERIOD_MS + 2))
+        hrtimer_cancel(&t); // timer interrupt lost, the tick was the backup
+}
@@ -0,0 +1,49 @@
+/*
+ *  High resolution timer on the core timer ( SYSCLK / 2, the RTOS tick is on Timer 1 )
+ *  hrtimer_ticks() extends the 32 bit Count to 64 bit, the compare interrupt comes at least
+ *  every 2^31 ticks so a wrap is never missed
+ *  One-shot callbacks run in the core timer ISR ( use the FromISR API there )
+ *  hrtimer_delay_us() spins below HRTIMER_SPIN_US and where a task cannot block ( ISR, critical section, no scheduler ),
+ *  otherwise the task sleeps on a one-shot and other tasks run
+ */
+
+#ifndef SYS_HRTIMER_H
+#define	SYS_HRTIMER_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+
+#define HRTIMER_INT_PRIO            2       /* <= configMAX_SYSCALL_INTERRUPT_PRIORITY */
+#define HRTIMER_SPIN_US             50      /* a task switch there and back costs about this */
+
+typedef struct hrtimer hrtimer_t;
+typedef void (* hrtimer_cb_t)(hrtimer_t * t, void * arg, BaseType_t * woken);
+
+struct hrtimer {
+    hrtimer_t * next;
+    uint64_t expire;                        /* core timer ticks */
+    hrtimer_cb_t cb;
+    void * arg;
+    bool armed;
+};
+
+void hrtimer_init(void);
+uint64_t hrtimer_ticks(void);
+uint64_t hrtimer_us(void);                  /* monotonic us since boot */
+
+void hrtimer_start(hrtimer_t * t, uint32_t us, hrtimer_cb_t cb, void * arg); /* one-shot, restarts an armed timer */
+bool hrtimer_cancel(hrtimer_t * t);         /* false when it has run already */
+
+void hrtimer_spin_us(uint32_t us);
+void hrtimer_delay_us(uint32_t us);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SYS_HRTIMER_H */
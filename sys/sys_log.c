@@ -9,8 +9,18 @@
 
 #endif
 
+#if defined(DBG_USE_DMA) && !(defined(DBG_USE_RING) && defined(FREERTOS))
+#error "DBG_USE_DMA drains the log ring from the LOG task, enable DBG_USE_RING"
+#endif
+
+#if defined(DBG_USE_RING) && defined(FREERTOS)
+static TaskHandle_t log_task = NULL;
+#endif
+
 #ifdef DBG_USE_DMA
+#include "fan_int.h"
 static char __attribute__((coherent)) log_buffer[DBG_BUF_MAX];
+static int log_buffer_len = 0;
 #endif
 
 void _mon_putc(char c) {
@@ -19,6 +29,336 @@ void _mon_putc(char c) {
     //while (!(U1STA & _U1STA_TRMT_MASK));
 }
 
+#ifdef DBG_USE_DMA
+
+static void dbg_init_dma(void) {
+    DMACONSET = _DMACON_ON_MASK;
+    DCH0CON = 0;
+    DCH0ECON = (_UART1_TX_VECTOR << _DCH0ECON_CHSIRQ_POSITION) | _DCH0ECON_SIRQEN_MASK;
+    DCH0DSA = KVA_TO_PA(&U1TXREG);
+    DCH0DSIZ = 1;
+    DCH0CSIZ = 1;
+    DCH0INTCLR = 0x00FF00FF;
+    DCH0INTSET = _DCH0INT_CHBCIE_MASK;
+    mDMA0SetIntPriority(DBG_DMA_PRIO);
+    mDMA0ClearIntFlag();
+    mDMA0IntEnable(1);
+}
+
+/* LOG task context, sleeps until the block is out */
+static void dbg_dma_write(void) {
+    DCH0SSA = KVA_TO_PA(log_buffer);
+    DCH0SSIZ = log_buffer_len;
+    DCH0INTCLR = _DCH0INT_CHBCIF_MASK;
+    DCH0CONSET = _DCH0CON_CHEN_MASK;
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    log_buffer_len = 0;
+}
+
+/* sys_log_isr.S */
+void ISR_DMA0(void) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    traceISR_ENTER(_DMA0_VECTOR);
+    DCH0INTCLR = _DCH0INT_CHBCIF_MASK;
+    mDMA0ClearIntFlag();
+    vTaskNotifyGiveFromISR(log_task, &xHigherPriorityTaskWoken);
+    traceISR_EXIT(_DMA0_VECTOR);
+    portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
+}
+
+#endif /* DBG_USE_DMA */
+
+#ifdef DBG_USE_RING
+
+/*
+ * Deferred log
+ * Producers (tasks and ISR) format into a lock-free ring, the LOG task drains it to UART1
+ * Slot space is claimed with a CAS on head, a record is published by writing its header last
+ * The drain zeroes every consumed byte, so a free slot never shows a stale COMMIT bit
+ *
+ * record: [ u32 header ][ payload ... ] aligned to 4
+ * header: COMMIT | TYPE | size of the whole record
+ *
+ * TEXT payload is the formatted line
+ * BIN  payload is the wire frame, see log_ring_vbin()
+ */
+
+#define LOG_REC_COMMIT      0x80000000u
+#define LOG_REC_TYPE_MASK   0x70000000u
+#define LOG_REC_TEXT        0x00000000u
+#define LOG_REC_PAD         0x10000000u
+#define LOG_REC_BIN         0x20000000u
+#define LOG_REC_SIZE_MASK   0x0000FFFFu
+#define LOG_REC_HDR         sizeof(uint32_t)
+#define LOG_RING_MASK       (DBG_RING_SIZE - 1)
+#define LOG_BIN_SYNC        0xA5
+#define LOG_BIN_HDR         11
+
+#if (DBG_RING_SIZE & LOG_RING_MASK) || (DBG_RING_SIZE > LOG_REC_SIZE_MASK)
+#error "DBG_RING_SIZE must be a power of 2 and less than 64k"
+#endif
+
+static struct {
+    volatile uint32_t head; /* producers */
+    volatile uint32_t tail; /* LOG task */
+    sys_log_stat_t stat;
+    uint32_t buffer[DBG_RING_SIZE / sizeof (uint32_t)];
+} log_ring;
+
+static inline uint32_t * log_ring_at(uint32_t pos) {
+    return (uint32_t *) ((uint8_t *) log_ring.buffer + (pos & LOG_RING_MASK));
+}
+
+/* returns the record payload or NULL if the ring is full */
+static uint8_t * log_ring_reserve(uint32_t size, uint32_t * hdr_pos) {
+    uint32_t head, off, pad, next;
+    size = (size + LOG_REC_HDR + 3) & ~3u;
+    if (size > DBG_RING_SIZE / 2) {
+        __sync_fetch_and_add(&log_ring.stat.dropped, 1);
+        return NULL;
+    }
+    do {
+        head = log_ring.head;
+        off = head & LOG_RING_MASK;
+        pad = (off + size > DBG_RING_SIZE) ? DBG_RING_SIZE - off : 0; /* records never wrap */
+        next = head + pad + size;
+        if (next - log_ring.tail > DBG_RING_SIZE) {
+            __sync_fetch_and_add(&log_ring.stat.dropped, 1);
+            return NULL;
+        }
+    } while (!__sync_bool_compare_and_swap(&log_ring.head, head, next));
+    if (pad)
+        *log_ring_at(head) = LOG_REC_COMMIT | LOG_REC_PAD | pad;
+    *hdr_pos = head + pad;
+    return (uint8_t *) log_ring_at(head + pad) + LOG_REC_HDR;
+}
+
+static void log_ring_commit(uint32_t hdr_pos, uint32_t size, uint32_t type) {
+    size = (size + LOG_REC_HDR + 3) & ~3u;
+    __sync_synchronize();
+    *log_ring_at(hdr_pos) = LOG_REC_COMMIT | type | size;
+}
+
+static int log_ring_vprintf(const char * frm, va_list ar) {
+    char line[DBG_LINE_MAX];
+    uint32_t pos, start = ReadCoreTimer();
+    uint8_t * p;
+    va_list copy;
+    va_copy(copy, ar);
+    int len = vsnprintf(line, sizeof (line), frm, ar);
+    if (len < 0) {
+        va_end(copy);
+        return -1;
+    }
+    p = log_ring_reserve(len + 1, &pos);
+    if (p) {
+        if (len < DBG_LINE_MAX)
+            memcpy(p, line, len + 1);
+        else
+            vsnprintf((char *) p, len + 1, frm, copy); /* long line, format again in place */
+        log_ring_commit(pos, len + 1, LOG_REC_TEXT);
+        __sync_fetch_and_add(&log_ring.stat.records, 1);
+    }
+    va_end(copy);
+    uint32_t elapsed = ReadCoreTimer() - start;
+    if (elapsed > log_ring.stat.max_ticks)
+        log_ring.stat.max_ticks = elapsed; /* a lost race here only loses a sample */
+    return p ? len : -1;
+}
+
+/*
+ * Deferred format, LogBin() / LOGI()
+ * The line is not formatted on target, the host rebuilds it from the ELF ( tools/log_decode.py )
+ *
+ * frame: [ 0xA5 ][ u16 size ][ u32 format address ][ u32 core timer ][ args ... ]
+ * args:  integers, chars, pointers - u32, ll / j - u64, floating point - double
+ *        strings - [ u8 len ][ chars ], are copied as they may not live until the drain
+ */
+static int log_ring_vbin(const char * frm, va_list ar) {
+    uint8_t frame[DBG_LINE_MAX];
+    uint32_t pos, start = ReadCoreTimer();
+    uint32_t size = LOG_BIN_HDR, u32;
+    uint64_t u64;
+    double d;
+    const char * f = frm, * s;
+    uint8_t * p;
+    int len;
+    u32 = (uint32_t) frm;
+    memcpy(frame + 3, &u32, 4);
+    memcpy(frame + 7, &start, 4);
+    while (*f) {
+        if (*f++ != '%') continue;
+        if (*f == '%') {
+            f++;
+            continue;
+        }
+        while (*f && strchr("-+ #0", *f)) f++;
+        for (len = 0; len < 2; len++) { /* width, .precision */
+            if (*f == '*') {
+                f++;
+                u32 = va_arg(ar, int);
+                if (size + 4 > sizeof (frame)) goto FULL;
+                memcpy(frame + size, &u32, 4);
+                size += 4;
+            } else {
+                while (*f >= '0' && *f <= '9') f++;
+            }
+            if (*f != '.') break;
+            f++;
+        }
+        len = 0;
+        while (*f && strchr("hlLqjzt", *f)) {
+            if (*f == 'l' || *f == 'q' || *f == 'j' || *f == 'L') len++;
+            f++;
+        }
+        switch (*f) {
+            case 0:
+                continue;
+            case 's':
+                s = va_arg(ar, const char *);
+                if (!s) s = "(null)";
+                len = strlen(s);
+                if (len > 255) len = 255;
+                if (size + 1 + len > sizeof (frame)) {
+                    if (size + 1 >= sizeof (frame)) goto FULL;
+                    len = sizeof (frame) - size - 1; /* truncated */
+                }
+                frame[size++] = len;
+                memcpy(frame + size, s, len);
+                size += len;
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                d = va_arg(ar, double);
+                if (size + 8 > sizeof (frame)) goto FULL;
+                memcpy(frame + size, &d, 8);
+                size += 8;
+                break;
+            case 'n':
+                (void) va_arg(ar, void *);
+                break;
+            default:
+                if (len >= 2) {
+                    u64 = va_arg(ar, uint64_t);
+                    if (size + 8 > sizeof (frame)) goto FULL;
+                    memcpy(frame + size, &u64, 8);
+                    size += 8;
+                } else {
+                    u32 = va_arg(ar, uint32_t);
+                    if (size + 4 > sizeof (frame)) goto FULL;
+                    memcpy(frame + size, &u32, 4);
+                    size += 4;
+                }
+                break;
+        }
+        f++;
+    }
+FULL:
+    frame[0] = LOG_BIN_SYNC;
+    frame[1] = (size - 3) & 0xFF;
+    frame[2] = (size - 3) >> 8;
+    p = log_ring_reserve(size, &pos);
+    if (p) {
+        memcpy(p, frame, size);
+        log_ring_commit(pos, size, LOG_REC_BIN);
+        __sync_fetch_and_add(&log_ring.stat.records, 1);
+    }
+    uint32_t elapsed = ReadCoreTimer() - start;
+    if (elapsed > log_ring.stat.max_ticks)
+        log_ring.stat.max_ticks = elapsed;
+    return p ? (int) size : -1;
+}
+
+static void log_write(const char * s, int size, bool sync) {
+#ifdef DBG_USE_DMA
+    if (!sync) {
+        while (size) {
+            int n = DBG_BUF_MAX - log_buffer_len;
+            if (n > size) n = size;
+            memcpy(log_buffer + log_buffer_len, s, n);
+            log_buffer_len += n;
+            s += n;
+            size -= n;
+            if (log_buffer_len == DBG_BUF_MAX)
+                dbg_dma_write();
+        }
+        return;
+    }
+#endif
+    while (size--)
+        _mon_putc(*s++);
+}
+
+/* the ring has one consumer at a time: the LOG task or a task in sys_log_flush() */
+static volatile uint32_t log_draining;
+
+static void log_drain(bool sync) {
+    uint32_t tail = log_ring.tail, hdr, size;
+    while (tail != log_ring.head) {
+        hdr = *log_ring_at(tail);
+        if (0 == (hdr & LOG_REC_COMMIT))
+            break; /* producer is still writing */
+        size = hdr & LOG_REC_SIZE_MASK;
+        if (LOG_REC_TEXT == (hdr & LOG_REC_TYPE_MASK)) {
+            char * s = (char *) log_ring_at(tail) + LOG_REC_HDR;
+            log_write(s, strlen(s), sync);
+        } else if (LOG_REC_BIN == (hdr & LOG_REC_TYPE_MASK)) {
+            uint8_t * b = (uint8_t *) log_ring_at(tail) + LOG_REC_HDR;
+            log_write((char *) b, 3 + (b[1] | b[2] << 8), sync);
+        }
+        memset(log_ring_at(tail), 0, size); /* a later header may land anywhere in it, must read 0 until committed */
+        __sync_synchronize();
+        tail += size;
+        log_ring.tail = tail;
+    }
+#ifdef DBG_USE_DMA
+    if (!sync && log_buffer_len)
+        dbg_dma_write();
+#endif
+}
+
+/*
+ * A task waits for a drain in progress and holds log_draining while it drains
+ * An ISR, interrupts off or no scheduler: asserts, traps and boot, the CPU never goes back to
+ * a preempted LOG task, so the ring is drained without the flag
+ */
+void sys_log_flush(void) {
+#ifdef FREERTOS
+    if (osal_can_block() && xTaskGetCurrentTaskHandle() != log_task) {
+        while (__sync_lock_test_and_set(&log_draining, 1))
+            vTaskDelay(1);
+        log_drain(true);
+        __sync_lock_release(&log_draining);
+        return;
+    }
+#endif
+    log_drain(true);
+}
+
+void sys_log_stat(sys_log_stat_t * stat) {
+    if (stat) *stat = log_ring.stat;
+}
+
+#ifdef FREERTOS
+
+static void entryLOG(void * arg) {
+    uint32_t dropped = 0;
+    while (1) {
+        if (0 == __sync_lock_test_and_set(&log_draining, 1)) {
+            log_drain(false);
+            __sync_lock_release(&log_draining);
+        }
+        if (dropped != log_ring.stat.dropped) {
+            dropped = log_ring.stat.dropped;
+            Printf("[LOG] dropped: %u\n", dropped);
+        }
+        delay_ms(DBG_DRAIN_MS);
+    }
+    (void) arg;
+}
+#endif
+
+#endif /* DBG_USE_RING */
+
 void sys_log_init(int32_t brg) {
     SYS_SystemUnlock();
     RPD15R = 1;
@@ -28,21 +368,57 @@ void sys_log_init(int32_t brg) {
     U1BRG = (uint32_t) (((float) SYS_CLK_BUS_PERIPHERAL_1 / (4.0 * brg))-(float) 0.5);
     U1STASET = _U1STA_UTXEN_MASK | _U1STA_URXEN_MASK;
     U1MODESET = _U1MODE_ON_MASK | _U1MODE_BRGH_MASK;
-#ifdef DBG_USE_DMA 
+#ifdef DBG_USE_DMA
     U1STAbits.UTXISEL = 1;
     dbg_init_dma();
-#endif      
+#endif
+#if defined(DBG_USE_RING) && defined(FREERTOS)
+    rtos_task_create(entryLOG, "LOG", configMINIMAL_STACK_SIZE * 2, NULL, TASK_PRIORITY_LOW, &log_task);
+#endif
 }
 
-int Printf(const char * frm, ...) {
-    if (NULL == frm || (0 == U1STA & _U1STA_UTXEN_MASK)) return -1;
-    int flag = (int) __builtin_disable_interrupts();
+#ifdef DBG_USE_RING
+static inline void log_kick(void) {
+#ifdef FREERTOS
+    if (NULL == log_task || taskSCHEDULER_NOT_STARTED == xTaskGetSchedulerState())
+#endif
+        sys_log_flush(); /* nobody to drain it yet */
+}
+
+int LogBin(const char * frm, ...) {
+    int res;
     va_list ar;
+    if (NULL == frm) return -1;
     va_start(ar, frm);
-    vprintf(frm, ar); //---> _mon_putc
+    res = log_ring_vbin(frm, ar);
     va_end(ar);
+    log_kick();
+    return res;
+}
+#endif
+
+int vPrintf(const char * frm, va_list ar) {
+    if (NULL == frm) return -1;
+#ifdef DBG_USE_RING
+    int res = log_ring_vprintf(frm, ar);
+    log_kick();
+    return res;
+#else
+    if (0 == (U1STA & _U1STA_UTXEN_MASK)) return -1;
+    int flag = (int) __builtin_disable_interrupts();
+    vprintf(frm, ar); //---> _mon_putc
     if (flag)__builtin_mtc0(12, 0, (__builtin_mfc0(12, 0) | 0x0001));
     return 0;
+#endif
+}
+
+int Printf(const char * frm, ...) {
+    int res;
+    va_list ar;
+    va_start(ar, frm);
+    res = vPrintf(frm, ar);
+    va_end(ar);
+    return res;
 }
 
 void PrintHex(char * begin, char * buffer, int size, char * end) {
@@ -51,4 +427,4 @@ void PrintHex(char * begin, char * buffer, int size, char * end) {
     while (size--)
         Printf("%02X", buffer[i++]&0xFF);
     if (end) Printf(end);
-}
\ No newline at end of file
+}
@@ -13,21 +13,48 @@ extern "C" {
 #endif
 
 #include "config.h" 
-#include <xc.h>    
+#include <stdint.h>
 #include <stdarg.h>
 #include <stdio.h>
    
 void sys_log_init(int32_t brg);
 int Printf(const char * frm, ...);
+int vPrintf(const char * frm, va_list ar);
 void PrintHex(char * begin, char * buffer, int size, char * end);
 
+#ifdef DBG_USE_RING
+typedef struct {
+    uint32_t records;   /* committed */
+    uint32_t dropped;   /* ring full */
+    uint32_t max_ticks; /* worst time in Printf, core timer ticks */
+} sys_log_stat_t;
+
+void sys_log_flush(void);
+void sys_log_stat(sys_log_stat_t * stat);
+#else
+#define sys_log_flush()
+#endif
+
+#ifdef DBG_USE_RING
+int LogBin(const char * frm, ...);
+#endif
+
 #ifdef DEBUG
 #   undef  printf
 #   define printf Printf
+#   if defined(DBG_USE_RING) && defined(DBG_USE_BIN) /* binary frames, the console needs tools/log_decode.py */
+#   define LOG(_F_, ARG...)         LogBin( (const char*) _F_, ##ARG )
+#   define LOG_BIN(_F_, ARG...)     LogBin( (const char*) _F_, ##ARG ) /* hot paths, format on host */
+#   else
 #   define LOG(_F_, ARG...)         Printf( (const char*) _F_, ##ARG )
-#   define LOG_ERROR()              Printf("[ERROR] %s() File: %s at Line %d\n", __FUNCTION__, __FILE__, __LINE__)
+#   define LOG_BIN(_F_, ARG...)     Printf( (const char*) _F_, ##ARG )
+#   endif
+#   define LOGI(_F_, ARG...)        LOG_BIN( _F_, ##ARG )
+#   define LOG_ERROR()              LOG_BIN("[ERROR] %s() File: %s at Line %d\n", __FUNCTION__, __FILE__, __LINE__)
 #else
 #   define LOG(_STR_, arg...) 
+#   define LOG_BIN(_STR_, arg...) 
+#   define LOGI(_STR_, arg...) 
 #   define LOG_ERROR()
 #endif
 
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+#  Decoder for the binary log records of sys/sys_log.c ( LogBin, LOGI, LOG with DBG_USE_BIN )
+#
+#  usage: log_decode.py firmware.elf [capture.bin] [-t]
+#         reads the UART capture ( or stdin ), plain text passes through,
+#         binary frames are formatted with the strings found in the ELF
+#
+#  frame: [ 0xA5 ][ u16 size ][ u32 format address ][ u32 core timer ][ args ... ]
+#
+
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+CORE_TIMER_HZ = 100000000  # SYS_CLK_FREQ / 2
+
+CONV = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?([hlLqjzt]*)([diouxXcspfFeEgGaAn%])')
+
+
+class Elf(object):
+
+    def __init__(self, path):
+        data = open(path, 'rb').read()
+        if data[:4] != b'\x7fELF' or data[4] != 1:
+            raise ValueError('%s: not an ELF32 file' % path)
+        e = '<' if data[5] == 1 else '>'
+        shoff, = struct.unpack_from(e + 'I', data, 0x20)
+        shentsize, shnum = struct.unpack_from(e + 'HH', data, 0x2E)
+        self.data = data
+        self.sections = []
+        for i in range(shnum):
+            sh = struct.unpack_from(e + 'IIIIIIIIII', data, shoff + i * shentsize)
+            sh_type, sh_flags, sh_addr, sh_offset, sh_size = sh[1], sh[2], sh[3], sh[4], sh[5]
+            if sh_type == 1 and sh_flags & 2 and sh_size:  # PROGBITS, ALLOC
+                self.sections.append((sh_addr, sh_offset, sh_size))
+
+    def string(self, addr):
+        for base, offset, size in self.sections:
+            if base <= addr < base + size:
+                start = offset + addr - base
+                end = self.data.index(b'\0', start)
+                return self.data[start:end].decode('latin-1')
+        return None
+
+
+def format_record(fmt, args):
+    out = []
+    pos = 0
+    for m in CONV.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, prec, length, conv = m.groups()
+        if conv == '%':
+            out.append('%')
+            continue
+        if width == '*':
+            width = str(args.int32())
+        if prec == '*':
+            prec = str(args.int32())
+        spec = '%' + flags + (width or '') + ('.' + prec if prec is not None else '')
+        if conv == 's':
+            out.append((spec + 's') % args.string())
+        elif conv in 'fFeEgGaA':
+            value = args.double()
+            out.append((spec + ('f' if conv in 'aA' else conv)) % value)
+        elif conv == 'n':
+            pass
+        elif conv == 'p':
+            out.append('0x%08x' % args.uint(False))
+        elif conv == 'c':
+            out.append((spec + 'c') % chr(args.uint(False) & 0xFF))
+        else:
+            wide = length.count('l') >= 2 or 'j' in length or 'q' in length or 'L' in length
+            if conv in 'di':
+                value = args.int(wide)
+            else:
+                value = args.uint(wide)
+            out.append((spec + ('d' if conv == 'u' else conv)) % value)
+    out.append(fmt[pos:])
+    return ''.join(out)
+
+
+class Args(object):
+
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, n):
+        if self.pos + n > len(self.data):
+            raise IndexError('record truncated')
+        v = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return v
+
+    def uint(self, wide):
+        return struct.unpack('<Q' if wide else '<I', self.take(8 if wide else 4))[0]
+
+    def int(self, wide):
+        return struct.unpack('<q' if wide else '<i', self.take(8 if wide else 4))[0]
+
+    def int32(self):
+        return self.int(False)
+
+    def double(self):
+        return struct.unpack('<d', self.take(8))[0]
+
+    def string(self):
+        n = self.take(1)[0]
+        return self.take(n).decode('latin-1')
+
+
+def decode(elf, stream, out, timestamps):
+    buf = stream.read()
+    i = 0
+    text = bytearray()
+    while i < len(buf):
+        b = buf[i]
+        if b != SYNC or i + 3 > len(buf):
+            text.append(b)
+            i += 1
+            continue
+        size = buf[i + 1] | buf[i + 2] << 8
+        frame = buf[i + 3:i + 3 + size]
+        if len(frame) != size or size < 8:
+            text.append(b)
+            i += 1
+            continue
+        out.write(text.decode('latin-1'))
+        text = bytearray()
+        i += 3 + size
+        addr, ticks = struct.unpack_from('<II', frame, 0)
+        fmt = elf.string(addr)
+        if timestamps:
+            out.write('[%10.6f] ' % (float(ticks) / CORE_TIMER_HZ))
+        if fmt is None:
+            out.write('[LOG] unknown format 0x%08X\n' % addr)
+            continue
+        try:
+            out.write(format_record(fmt, Args(frame[8:])))
+        except (IndexError, TypeError, ValueError) as e:
+            out.write('[LOG] bad record for "%s": %s\n' % (fmt.rstrip(), e))
+    out.write(text.decode('latin-1'))
+
+
+def main(argv):
+    args = [a for a in argv[1:] if not a.startswith('-')]
+    if not args:
+        sys.stderr.write('usage: %s firmware.elf [capture.bin] [-t]\n' % argv[0])
+        return 1
+    elf = Elf(args[0])
+    stream = open(args[1], 'rb') if len(args) > 1 else sys.stdin.buffer
+    decode(elf, stream, sys.stdout, '-t' in argv)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+#  Converter for the kernel event dumps of middleware/wizio/trace_rec.c ( trace_rec_dump() )
+#  to Chrome trace / Perfetto JSON, open the result in chrome://tracing or ui.perfetto.dev
+#
+#  usage: trace2json.py [capture.txt] [-o trace.json]
+#         reads the log capture ( or stdin ), binary logs go through log_decode.py first,
+#         every [TRC] BEGIN ... [TRC] END block becomes one process in the output
+#
+#  record line: [TRC] <core timer hex> <event> <task number> <arg>
+#
+
+import json
+import re
+import sys
+
+REC = re.compile(r'\[TRC\] ([0-9A-Fa-f]{8}) (\S) (\d+) (\d+)')
+NAME = re.compile(r'\[TRC\] N (\d+) (.*)')
+BEGIN = re.compile(r'\[TRC\] BEGIN (\d+) (\d+)')
+
+QUEUE_TYPES = {0: 'queue', 1: 'mutex', 2: 'counting', 3: 'binary', 4: 'recursive'}
+VECTORS = {0: 'hrtimer', 4: 'tick', 18: 'MRF24WN', 134: 'DMA0 log', 135: 'MRF24WN DMA'}
+USER_IDS = {1: 'handshake'}
+ISR_TID = 1000
+
+
+class Dump(object):
+
+    def __init__(self, hz):
+        self.hz = hz
+        self.names = {}
+        self.records = []
+
+
+def parse(stream):
+    dumps = []
+    dump = None
+    for line in stream:
+        m = BEGIN.search(line)
+        if m:
+            dump = Dump(int(m.group(1)))
+            dumps.append(dump)
+            continue
+        if dump is None:
+            continue
+        if '[TRC] END' in line:
+            dump = None
+            continue
+        m = NAME.search(line)
+        if m:
+            dump.names[int(m.group(1))] = m.group(2).strip()
+            continue
+        m = REC.search(line)
+        if m:
+            dump.records.append((int(m.group(1), 16), m.group(2), int(m.group(3)), int(m.group(4))))
+    return dumps
+
+
+class Converter(object):
+
+    def __init__(self, pid, dump):
+        self.pid = pid
+        self.dump = dump
+        self.events = []
+        self.queues = {}
+        self.flow = 0
+        self.pending_send = {}      # queue -> flow id
+        self.pending_notify = {}    # task -> flow id
+        self.isr = []               # vectors of the ISRs running
+        self.running = None         # (task, start us)
+        self.threads = set()
+
+    def task_name(self, task):
+        return self.dump.names.get(task, 'task %u' % task)
+
+    def queue_name(self, q):
+        return ('Q%u %s' % (q, self.queues[q])) if q in self.queues else 'Q%u' % q
+
+    def thread(self, tid, name):
+        if tid not in self.threads:
+            self.threads.add(tid)
+            self.events.append({'ph': 'M', 'pid': self.pid, 'tid': tid, 'name': 'thread_name', 'args': {'name': name}})
+
+    def emit(self, ph, ts, tid, name, **kw):
+        e = {'ph': ph, 'pid': self.pid, 'tid': tid, 'ts': ts, 'name': name}
+        e.update(kw)
+        self.events.append(e)
+
+    def context(self, task):
+        # events from an ISR go to its track, the others to the running task
+        if self.isr:
+            return ISR_TID + self.isr[-1]
+        return task
+
+    def flow_start(self, ts, tid):
+        self.flow += 1
+        self.emit('s', ts, tid, 'wake', id=self.flow, cat='flow')
+        return self.flow
+
+    def flow_end(self, ts, tid, fid):
+        self.emit('f', ts, tid, 'wake', id=fid, cat='flow', bp='e')
+
+    def convert(self):
+        base = None
+        last = None
+        for time, event, task, arg in self.dump.records:
+            if base is None:
+                base = last = time
+                wide = 0
+            wide += (time - last) & 0xFFFFFFFF
+            last = time
+            ts = wide * 1e6 / self.dump.hz
+            self.record(ts, event, task, arg)
+        if self.running is not None:
+            self.switch_out(ts)
+        self.events.insert(0, {'ph': 'M', 'pid': self.pid, 'name': 'process_name', 'args': {'name': 'PIC32 trace %u' % self.pid}})
+        return self.events
+
+    def switch_out(self, ts):
+        task, start = self.running
+        self.emit('X', start, task, self.task_name(task), dur=max(ts - start, 0.001), cat='run')
+        self.running = None
+
+    def record(self, ts, event, task, arg):
+        if event == 'T':
+            if self.running is not None:
+                self.switch_out(ts)
+            self.thread(task, self.task_name(task))
+            self.running = (task, ts)
+            if task in self.pending_notify:
+                self.flow_end(ts, task, self.pending_notify.pop(task))
+        elif event == 'C':
+            self.thread(task, self.task_name(task))
+            self.emit('i', ts, task, 'create prio %u' % arg, s='t')
+        elif event == 'D':
+            self.emit('i', ts, task, 'delete', s='t')
+        elif event == 'I':
+            tid = ISR_TID + arg
+            self.thread(tid, 'ISR %s' % VECTORS.get(arg, arg))
+            self.isr.append(arg)
+            self.emit('B', ts, tid, VECTORS.get(arg, 'vector %u' % arg), cat='isr')
+        elif event == 'i':
+            if arg in self.isr:
+                self.isr.remove(arg)
+                self.emit('E', ts, ISR_TID + arg, VECTORS.get(arg, 'vector %u' % arg), cat='isr')
+        elif event == 'Q':
+            self.queues[arg & 0x0FFF] = QUEUE_TYPES.get(arg >> 12, '')
+        elif event in 'Ss':
+            tid = self.context(task)
+            self.emit('i', ts, tid, 'send ' + self.queue_name(arg), s='t')
+            self.pending_send[arg] = self.flow_start(ts, tid)
+        elif event in 'Rr':
+            tid = self.context(task)
+            self.emit('i', ts, tid, 'receive ' + self.queue_name(arg), s='t')
+            if arg in self.pending_send:
+                self.flow_end(ts, tid, self.pending_send.pop(arg))
+        elif event in 'Ww':
+            self.emit('i', ts, task, 'block on ' + self.queue_name(arg), s='t')
+        elif event == 'N':
+            tid = self.context(task)
+            self.emit('i', ts, tid, 'notify ' + self.task_name(arg), s='t')
+            self.pending_notify[arg] = self.flow_start(ts, tid)
+        elif event == 'n':
+            self.emit('i', ts, task, 'wait notify', s='t')
+        elif event == 'U':
+            self.emit('B', ts, task, USER_IDS.get(arg, 'user %u' % arg), cat='user')
+        elif event == 'u':
+            self.emit('E', ts, task, USER_IDS.get(arg, 'user %u' % arg), cat='user')
+        elif event == 'M':
+            self.emit('i', ts, self.context(task), 'mark %u' % arg, s='t')
+
+
+def main(argv):
+    args = [a for a in argv[1:] if not a.startswith('-')]
+    out = sys.stdout
+    if '-o' in argv:
+        i = argv.index('-o')
+        if i + 1 >= len(argv):
+            sys.stderr.write('usage: %s [capture.txt] [-o trace.json]\n' % argv[0])
+            return 1
+        args.remove(argv[i + 1])
+        out = open(argv[i + 1], 'w')
+    stream = open(args[0], 'r', errors='replace') if args else sys.stdin
+    dumps = parse(stream)
+    if not dumps:
+        sys.stderr.write('no [TRC] BEGIN found\n')
+        return 1
+    events = []
+    for pid, dump in enumerate(dumps, 1):
+        events += Converter(pid, dump).convert()
+    json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, out)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))